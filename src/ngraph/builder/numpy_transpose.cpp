@@ -20,6 +20,7 @@
 #include "ngraph/builder/numpy_transpose.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/shape_util.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -73,6 +74,13 @@ namespace ngraph
             for (size_t i = 0; i < in_shape.size(); ++i)
                 out_shape.push_back(in_shape[order[i]]);
 
+            // Moving only axes of size one leaves the elements in place, so a reshape without
+            // reordering does, and it is free for backends that reshape in place
+            if (is_layout_preserving_transpose(in_shape, order))
+            {
+                order = get_default_order(in_shape);
+            }
+
             // do the reshaping with the order
             return std::make_shared<ngraph::op::Reshape>(value, order, out_shape)
                 ->add_provenance_group_members_above({value});
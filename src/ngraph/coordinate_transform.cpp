@@ -29,6 +29,45 @@
 
 using namespace ngraph;
 
+StridedIndexRange::StridedIndexRange(const Shape& shape, const Strides& strides, size_t offset)
+    : m_shape(shape)
+    , m_strides(strides)
+    , m_offset(offset)
+    , m_size(shape_size(shape))
+{
+    if (shape.size() != strides.size())
+    {
+        throw std::domain_error("Strides do not have the same number of axes as the shape");
+    }
+    merge_strided_axes(m_shape, std::array<Strides*, 1>{{&m_strides}});
+}
+
+bool StridedIndexRange::is_contiguous() const
+{
+    return m_shape.empty() || (m_shape.size() == 1 && m_strides[0] == 1);
+}
+
+StridedIndexRange::Iterator::Iterator(const StridedIndexRange& range, bool is_end)
+    : m_counter(range.m_shape, {{&range.m_strides}}, range.m_shape.size(), 0, {{range.m_offset}})
+    , m_remaining(is_end ? 0 : range.m_size)
+{
+}
+
+Strides ngraph::reduction_strides(const Shape& shape, const AxisSet& reduction_axes)
+{
+    Strides strides(shape.size(), 0);
+    size_t stride = 1;
+    for (size_t axis = shape.size(); axis-- > 0;)
+    {
+        if (reduction_axes.count(axis) == 0)
+        {
+            strides[axis] = stride;
+            stride *= shape[axis];
+        }
+    }
+    return strides;
+}
+
 CoordinateTransform::CoordinateTransform(const Shape& source_shape,
                                          const Coordinate& source_start_corner,
                                          const Coordinate& source_end_corner,
@@ -378,6 +417,68 @@ const Shape& CoordinateTransform::get_target_shape() const
     return m_target_shape;
 }
 
+bool CoordinateTransform::has_all_source_coordinates() const
+{
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+    {
+        if (m_target_shape[target_axis] == 0)
+        {
+            return true;
+        }
+    }
+
+    // Same mapping as `to_source_coordinate`, applied to the first and last position of
+    // every axis.
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+    {
+        size_t source_axis = m_source_axis_order[target_axis];
+
+        if (m_target_dilation_strides[target_axis] != 1)
+        {
+            return false;
+        }
+
+        std::ptrdiff_t first = static_cast<std::ptrdiff_t>(m_source_start_corner[source_axis]) -
+                               m_target_padding_below[target_axis];
+        std::ptrdiff_t last =
+            first + static_cast<std::ptrdiff_t>((m_target_shape[target_axis] - 1) *
+                                                m_source_strides[source_axis]);
+
+        if (first < 0 || last >= static_cast<std::ptrdiff_t>(m_source_shape[source_axis]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+StridedIndexRange CoordinateTransform::source_indices() const
+{
+    if (!has_all_source_coordinates())
+    {
+        throw std::domain_error(
+            "Source indices requested for a coordinate transform with padding or dilation");
+    }
+
+    Strides source_row_strides = row_major_strides(m_source_shape);
+    Strides strides(m_n_axes);
+    size_t offset = 0;
+
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+    {
+        size_t source_axis = m_source_axis_order[target_axis];
+        strides[target_axis] = m_source_strides[source_axis] * source_row_strides[source_axis];
+        if (m_target_shape[target_axis] != 0)
+        {
+            offset += (m_source_start_corner[source_axis] - m_target_padding_below[target_axis]) *
+                      source_row_strides[source_axis];
+        }
+    }
+
+    return StridedIndexRange(m_target_shape, strides, offset);
+}
+
 // The "is_end" parameter is true if we want the "end()" iterator.
 CoordinateTransform::Iterator::Iterator(const Shape& target_shape, bool is_end)
     : m_target_shape(target_shape)
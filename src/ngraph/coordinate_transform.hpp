@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+
+#include "ngraph/axis_set.hpp"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate.hpp"
 #include "ngraph/coordinate_diff.hpp"
@@ -24,6 +28,162 @@
 
 namespace ngraph
 {
+    /// \brief Simplifies a row-major walk over shape that steps through N buffers, the i-th
+    ///        by (*strides[i])[axis] along each axis. Axes of size one are dropped, and an axis
+    ///        is merged into its outer neighbour when, in every buffer, one step along the
+    ///        outer axis spans the whole inner axis. The walk then reaches the same indices in
+    ///        the same order over fewer, longer axes.
+    template <typename STRIDES, size_t N>
+    void merge_strided_axes(Shape& shape, const std::array<STRIDES*, N>& strides)
+    {
+        size_t rank = 0;
+        for (size_t axis = 0; axis < shape.size(); axis++)
+        {
+            if (shape[axis] == 1)
+            {
+                continue;
+            }
+            auto size = static_cast<typename STRIDES::value_type>(shape[axis]);
+            bool merge = rank > 0;
+            for (size_t i = 0; i < N && merge; i++)
+            {
+                merge = (*strides[i])[rank - 1] == (*strides[i])[axis] * size;
+            }
+            if (merge)
+            {
+                shape[rank - 1] *= shape[axis];
+            }
+            else
+            {
+                shape[rank++] = shape[axis];
+            }
+            for (size_t i = 0; i < N; i++)
+            {
+                (*strides[i])[rank - 1] = (*strides[i])[axis];
+            }
+        }
+        shape.resize(rank);
+        for (size_t i = 0; i < N; i++)
+        {
+            strides[i]->resize(rank);
+        }
+    }
+
+    /// \brief A coordinate in a row-major walk over the first axes of shape, with the index it
+    ///        reaches in each of N buffers walked by their own strides. Stepping updates the
+    ///        indices incrementally.
+    template <typename STRIDES, size_t N>
+    class StridedCounter
+    {
+    public:
+        using Index = typename STRIDES::value_type;
+
+        /// \brief Starts at the position-th coordinate of the first n_axes axes of shape, whose
+        ///        index in buffer i is offsets[i] plus the coordinate mapped through strides[i].
+        StridedCounter(const Shape& shape,
+                       const std::array<const STRIDES*, N>& strides,
+                       size_t n_axes,
+                       size_t position,
+                       const std::array<Index, N>& offsets = {})
+            : m_shape(&shape)
+            , m_strides(strides)
+            , m_coordinate(n_axes)
+            , m_index(offsets)
+        {
+            for (size_t axis = n_axes; axis-- > 0 && position > 0;)
+            {
+                m_coordinate[axis] = position % shape[axis];
+                position /= shape[axis];
+                for (size_t i = 0; i < N; i++)
+                {
+                    m_index[i] += static_cast<Index>(m_coordinate[axis]) * (*strides[i])[axis];
+                }
+            }
+        }
+
+        /// \brief Moves to the next coordinate, or back to the first one after the last
+        void operator++()
+        {
+            for (size_t axis = m_coordinate.size(); axis-- > 0;)
+            {
+                for (size_t i = 0; i < N; i++)
+                {
+                    m_index[i] += (*m_strides[i])[axis];
+                }
+                if (++m_coordinate[axis] < (*m_shape)[axis])
+                {
+                    return;
+                }
+                auto size = static_cast<Index>((*m_shape)[axis]);
+                for (size_t i = 0; i < N; i++)
+                {
+                    m_index[i] -= (*m_strides[i])[axis] * size;
+                }
+                m_coordinate[axis] = 0;
+            }
+        }
+
+        /// \returns The index of the coordinate in buffer i
+        Index operator[](size_t i) const { return m_index[i]; }
+    private:
+        const Shape* m_shape;
+        std::array<const STRIDES*, N> m_strides;
+        Coordinate m_coordinate;
+        std::array<Index, N> m_index;
+    };
+
+    /// \brief A row-major walk over an index space that yields, for every coordinate c, the
+    ///        buffer index offset + sum(c[i] * strides[i]).
+    ///
+    /// The index is updated incrementally as the walk advances, so no coordinates are
+    /// materialized. Strides may be zero, which repeats data along that axis (broadcast) or
+    /// maps several coordinates to the same index (reduction). Unit axes are dropped and
+    /// adjacent axes that are contiguous with each other are merged, so a dense row-major
+    /// walk degenerates into a single linear count.
+    class StridedIndexRange
+    {
+    public:
+        StridedIndexRange(const Shape& shape, const Strides& strides, size_t offset = 0);
+
+        class Iterator
+        {
+        public:
+            Iterator(const StridedIndexRange& range, bool is_end = false);
+
+            void operator++()
+            {
+                if (--m_remaining != 0)
+                {
+                    ++m_counter;
+                }
+            }
+            size_t operator*() const { return m_counter[0]; }
+            bool operator!=(const Iterator& it) const { return m_remaining != it.m_remaining; }
+            bool operator==(const Iterator& it) const { return m_remaining == it.m_remaining; }
+        private:
+            StridedCounter<Strides, 1> m_counter;
+            size_t m_remaining;
+        };
+
+        Iterator begin() const { return Iterator(*this); }
+        Iterator end() const { return Iterator(*this, true); }
+        /// \brief Number of indices produced by the walk
+        size_t size() const { return m_size; }
+        /// \brief True if the walk produces offset, offset + 1, ..., offset + size() - 1
+        bool is_contiguous() const;
+        size_t get_offset() const { return m_offset; }
+    private:
+        Shape m_shape;
+        Strides m_strides;
+        size_t m_offset;
+        size_t m_size;
+    };
+
+    /// \brief Returns the strides that map a coordinate in \p shape to the row-major index of
+    ///        the corresponding coordinate in reduce(shape, reduction_axes). Reduced axes get
+    ///        a stride of zero.
+    Strides reduction_strides(const Shape& shape, const AxisSet& reduction_axes);
+
     class CoordinateTransform
     {
     public:
@@ -66,6 +226,14 @@ namespace ngraph
         Coordinate to_source_coordinate(const Coordinate& c) const;
         const Shape& get_target_shape() const;
 
+        /// \brief Returns true if every coordinate in the target space has a source coordinate,
+        ///        i.e. no target coordinate falls into padding or a dilation gap.
+        bool has_all_source_coordinates() const;
+
+        /// \brief Returns the source buffer indices of all target coordinates, in row-major
+        ///        target order. Requires has_all_source_coordinates().
+        StridedIndexRange source_indices() const;
+
         const Shape& get_source_shape() const { return m_source_shape; }
         const Coordinate& get_source_start_corner() const { return m_source_start_corner; }
         const Coordinate& get_source_end_corner() const { return m_source_end_corner; }
@@ -31,6 +31,8 @@ descriptor::Input::Input(Node* node, size_t index, Output& output)
 {
     m_src_node = std::shared_ptr<Node>(output.get_node());
     output.add_input(this);
+    m_node->m_needs_revalidation = true;
+    Node::m_graph_version++;
 }
 
 descriptor::Input::Input(Node* node, size_t index)
@@ -56,6 +58,8 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->m_needs_revalidation = true;
+    Node::m_graph_version++;
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
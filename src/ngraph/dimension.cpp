@@ -121,10 +121,10 @@ bool Dimension::broadcast_merge(Dimension& dst, const Dimension d1, const Dimens
     }
     else
     {
-        // Static sizes. Both match or one of them is 1.
+        // Static sizes. Both match or one of them is 1, which takes the size of the other.
         if (int64_t(d1) == int64_t(d2) || int64_t(d1) == 1 || int64_t(d2) == 1)
         {
-            dst = std::max(int64_t(d1), int64_t(d2));
+            dst = int64_t(d1) == 1 ? d2 : d1;
             return true;
         }
         else
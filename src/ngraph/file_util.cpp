@@ -20,6 +20,7 @@
 #include <dirent.h>
 #include <ftw.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif
@@ -202,6 +203,33 @@ string file_util::get_temp_directory_path()
     return path;
 }
 
+shared_ptr<char> file_util::map_file(const string& path, size_t& size)
+{
+    shared_ptr<char> data;
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return data;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        size_t map_size = static_cast<size_t>(st.st_size);
+        void* p = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED)
+        {
+            size = map_size;
+            data = shared_ptr<char>(static_cast<char*>(p),
+                                    [map_size](char* ptr) { munmap(ptr, map_size); });
+        }
+    }
+    // The mapping stays valid after the file is closed
+    close(fd);
+#endif
+    return data;
+}
+
 vector<char> file_util::read_file_contents(const string& path)
 {
     size_t file_size = get_file_size(path);
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -67,6 +68,15 @@ namespace ngraph
         /// \param file The path to the file to be removed
         void remove_file(const std::string& file);
 
+        /// \brief Maps a file into memory. Pages are read as they are first touched and are
+        ///    shared with other processes mapping the same file. The mapping is private, so
+        ///    writes to it are not seen by the file or by other processes.
+        /// \param path The path of the file to map
+        /// \param size Set to the size of the file
+        /// \return The start of the mapping, which is unmapped once the last copy of the pointer
+        ///    is gone, or nullptr if the file can not be mapped
+        std::shared_ptr<char> map_file(const std::string& path, size_t& size);
+
         /// \brief Reads the contents of a file
         /// \param path The path of the file to read
         /// \return vector<char> of the file's contents
@@ -78,6 +78,52 @@ void Function::validate_nodes_and_infer_types()
     ngraph::validate_nodes_and_infer_types(get_ops());
 }
 
+void Function::validate_edited_nodes_and_infer_types()
+{
+    // Revalidation does not connect or disconnect nodes, so the cached order stays valid and
+    // its nodes alive while it runs
+    vector<Node*> ordered_ops;
+    {
+        lock_guard<mutex> lock(m_ordered_ops_mutex);
+        OrderedOps& cache = m_ordered_ops[1];
+        size_t graph_version = Node::get_graph_version();
+        if (!cache.m_valid || cache.m_graph_version != graph_version)
+        {
+            sort_ordered_ops(cache, true, graph_version);
+        }
+        ordered_ops = cache.m_ops;
+    }
+
+    vector<pair<element::Type, PartialShape>> output_types;
+    for (Node* node : ordered_ops)
+    {
+        if (!node->needs_revalidation())
+        {
+            continue;
+        }
+        output_types.clear();
+        for (auto& output : node->outputs())
+        {
+            output_types.emplace_back(output.get_element_type(), output.get_partial_shape());
+        }
+        node->revalidate_and_infer_types();
+        for (auto& output : node->outputs())
+        {
+            size_t i = output.get_index();
+            if (i < output_types.size() &&
+                output_types[i].first == output.get_element_type() &&
+                output_types[i].second.same_scheme(output.get_partial_shape()))
+            {
+                continue;
+            }
+            for (auto& input : output.get_target_inputs())
+            {
+                input.get_node()->mark_for_revalidation();
+            }
+        }
+    }
+}
+
 void Function::init()
 {
     validate_nodes_and_infer_types();
@@ -97,6 +143,36 @@ void Function::init()
 }
 
 std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    OrderedOps& cache = m_ordered_ops[include_control_deps ? 1 : 0];
+    // Read before sorting, so an edit made while sorting leaves the cache stale
+    size_t graph_version = Node::get_graph_version();
+    if (cache.m_valid && cache.m_graph_version == graph_version)
+    {
+        std::list<shared_ptr<Node>> result;
+        for (Node* node : cache.m_ops)
+        {
+            result.push_back(node->shared_from_this());
+        }
+        return result;
+    }
+    return sort_ordered_ops(cache, include_control_deps, graph_version);
+}
+
+void Function::set_topological_sort(topological_sort_t sort)
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    m_topological_sort = sort;
+    for (OrderedOps& cache : m_ordered_ops)
+    {
+        cache.m_valid = false;
+    }
+}
+
+std::list<shared_ptr<Node>> Function::sort_ordered_ops(OrderedOps& cache,
+                                                       bool include_control_deps,
+                                                       size_t graph_version) const
 {
     NodeVector nodes;
     for (auto& r : get_results())
@@ -108,7 +184,18 @@ std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps)
         nodes.push_back(param);
     }
 
-    return topological_sort(nodes, include_control_deps);
+    std::list<shared_ptr<Node>> result = m_topological_sort
+                                             ? m_topological_sort(nodes, include_control_deps)
+                                             : topological_sort(nodes, include_control_deps);
+    cache.m_ops.clear();
+    cache.m_ops.reserve(result.size());
+    for (auto& node : result)
+    {
+        cache.m_ops.push_back(node.get());
+    }
+    cache.m_graph_version = graph_version;
+    cache.m_valid = true;
+    return result;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -294,4 +381,8 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    // A parameter without users is only reachable through m_parameters
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    m_ordered_ops[0].m_valid = false;
+    m_ordered_ops[1].m_valid = false;
 }
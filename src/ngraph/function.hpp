@@ -17,9 +17,11 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -34,6 +36,9 @@ namespace ngraph
     class Function : public Lambda
     {
     public:
+        using topological_sort_t = std::function<std::list<std::shared_ptr<Node>>(
+            const NodeVector& root_nodes, bool include_control_deps)>;
+
         static constexpr DiscreteTypeInfo type_info{"Function", 0};
         const DiscreteTypeInfo& get_type_info() const { return type_info; }
         Function(const NodeVector& results,
@@ -93,7 +98,13 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
+        /// \brief Returns the ops in topological order. The order is cached and only sorted
+        /// again once Node::get_graph_version() shows that some graph has been edited.
         std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Replaces the sort get_ordered_ops uses, which is topological_sort by default.
+        /// \param sort Returns the nodes needed to compute root_nodes, each after the nodes it
+        ///    depends on. The results and parameters are passed as the root nodes.
+        void set_topological_sort(topological_sort_t sort);
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
         friend std::ostream& operator<<(std::ostream&, const Function&);
@@ -104,6 +115,10 @@ namespace ngraph
         void replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl);
 
         void validate_nodes_and_infer_types();
+        /// \brief Revalidates only the nodes that need it (see Node::needs_revalidation), in
+        /// topological order. The users of a node are revalidated in turn only if its output
+        /// types changed.
+        void validate_edited_nodes_and_infer_types();
 
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
@@ -139,5 +154,21 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
+
+        struct OrderedOps
+        {
+            bool m_valid = false;
+            size_t m_graph_version = 0;
+            // Kept alive by the results as long as the graph version is unchanged
+            std::vector<Node*> m_ops;
+        };
+        // Sorts the ops into cache, which must be locked
+        std::list<std::shared_ptr<Node>> sort_ordered_ops(OrderedOps& cache,
+                                                          bool include_control_deps,
+                                                          size_t graph_version) const;
+        topological_sort_t m_topological_sort;
+        mutable std::mutex m_ordered_ops_mutex;
+        // Indexed by include_control_deps
+        mutable OrderedOps m_ordered_ops[2];
     };
 }
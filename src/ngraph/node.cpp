@@ -28,6 +28,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/serializer.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -35,6 +36,7 @@ using namespace ngraph;
 constexpr NodeTypeInfo Node::type_info;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_graph_version(0);
 
 Node::Node(size_t output_size)
     : Node()
@@ -208,14 +210,14 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
-    validate_and_infer_types();
+    revalidate_and_infer_types();
 #endif
 }
 
 void Node::delayed_validate_and_infer_types()
 {
 #ifndef IN_TRANSITION
-    validate_and_infer_types();
+    revalidate_and_infer_types();
 #endif
 }
 #undef IN_TRANSITION
@@ -492,6 +494,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        m_graph_version++;
     }
 }
 
@@ -518,6 +521,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            m_graph_version++;
         }
     }
     {
@@ -540,6 +544,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    m_graph_version++;
 }
 
 void Node::clear_control_dependents()
@@ -913,3 +918,18 @@ bool Node::is_dynamic() const
     }
     return false;
 }
+
+size_t Node::get_attribute_hash() const
+{
+    return hash<string>()(serialize_node_attributes(*this));
+}
+
+bool Node::has_same_attributes(const Node& other) const
+{
+    if (typeid(*this) != typeid(other) || has_state() || other.has_state())
+    {
+        return false;
+    }
+    string attributes = serialize_node_attributes(*this);
+    return !attributes.empty() && attributes == serialize_node_attributes(other);
+}
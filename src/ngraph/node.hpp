@@ -196,7 +196,18 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types()
+        {
+            validate_and_infer_types();
+            m_needs_revalidation = false;
+        }
+        /// \brief True if an input of this node has been connected to another output, or the
+        /// node was marked with mark_for_revalidation, since its types were last inferred.
+        bool needs_revalidation() const { return m_needs_revalidation; }
+        /// \brief Makes Function::validate_edited_nodes_and_infer_types revalidate this node.
+        /// Needed after an edit that can change the node's output types other than through its
+        /// inputs, such as changing the shape of a Parameter.
+        void mark_for_revalidation() { m_needs_revalidation = true; }
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -266,7 +277,23 @@ namespace ngraph
         virtual bool is_commutative() const { return false; }
         virtual bool is_dynamic() const;
         virtual bool has_state() const { return false; }
+        /// \brief Hash of the attributes of this node, the values other than its inputs that
+        /// determine its outputs. Nodes for which has_same_attributes is true hash the same.
+        virtual size_t get_attribute_hash() const;
+        /// \brief True if other is the same op as this node with the same attributes, so that
+        /// both compute the same outputs from the same inputs. The default implementation
+        /// compares what the serializer writes for the nodes; it is false for ops with state
+        /// and for ops the serializer does not know or does not write all the attributes of.
+        virtual bool has_same_attributes(const Node& other) const;
+        /// \brief True if get_attribute_hash and has_same_attributes are the default ones, which
+        /// compare what serialize_node_attributes writes. Callers comparing many nodes may then
+        /// serialize each node once and compare the strings themselves.
+        virtual bool has_serialized_attributes() const { return true; }
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief Changes whenever an input of any node is connected to another output or a
+        /// control dependency is added or removed. A traversal of a graph cached along with
+        /// this version is still valid while the version is unchanged.
+        static size_t get_graph_version() { return m_graph_version; }
         friend std::ostream& operator<<(std::ostream&, const Node&);
         virtual std::ostream& write_short_description(std::ostream&) const;
         virtual std::ostream& write_long_description(std::ostream&) const;
@@ -515,8 +542,11 @@ namespace ngraph
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
+        bool m_needs_revalidation{false};
         NGRAPH_API
         static std::atomic<size_t> m_next_instance_id;
+        NGRAPH_API
+        static std::atomic<size_t> m_graph_version;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
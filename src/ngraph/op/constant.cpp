@@ -16,9 +16,12 @@
 
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/sha256.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -257,10 +260,106 @@ AxisSet op::Constant::get_axis_set_val() const
     return output_axis_set;
 }
 
+// Decoding a literal costs far more than an elementwise op, so large constants are split
+// across the intra-op pool in smaller pieces
+template <typename T>
+static vector<T> parse_values(const vector<string>& values)
+{
+    vector<T> result(values.size());
+    runtime::parallel_for(
+        values.size(), runtime::parallel_grain(16), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                result[i] = parse_string<T>(values[i]);
+            }
+        });
+    return result;
+}
+
+op::Constant::Constant(const element::Type& type, Shape shape, const vector<string>& values)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(new runtime::AlignedBuffer(shape_size(m_shape) * m_element_type.size(),
+                                        host_alignment()))
+{
+    NODE_VALIDATION_CHECK(this,
+                          values.size() == shape_size(m_shape) || values.size() == 1,
+                          "Did not get the expected number of literals for a constant of shape ",
+                          m_shape,
+                          " (got ",
+                          values.size(),
+                          ", expected ",
+                          shape_size(m_shape),
+                          ".");
+    if (values.size())
+    {
+        if (type.is_integral())
+        {
+            if (type.is_signed())
+            {
+                vector<int64_t> dvalues = parse_values<int64_t>(values);
+                if (values.size() == 1 && shape_size(m_shape) != 1)
+                {
+                    dvalues = vector<int64_t>(shape_size(m_shape), dvalues[0]);
+                }
+                write_values(dvalues);
+            }
+            else
+            {
+                vector<uint64_t> dvalues = parse_values<uint64_t>(values);
+                if (values.size() == 1 && shape_size(m_shape) != 1)
+                {
+                    dvalues = vector<uint64_t>(shape_size(m_shape), dvalues[0]);
+                }
+                write_values(dvalues);
+            }
+        }
+        else
+        {
+            vector<double> dvalues = parse_values<double>(values);
+            if (values.size() == 1 && shape_size(m_shape) != 1)
+            {
+                dvalues = vector<double>(shape_size(m_shape), dvalues[0]);
+            }
+            write_values(dvalues);
+        }
+    }
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    NGRAPH_CHECK(m_data && m_data->size() >= shape_size(m_shape) * m_element_type.size(),
+                 "Constant data is smaller than its shape");
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
+void* op::Constant::get_data_ptr_nc()
+{
+    {
+        lock_guard<mutex> lock(m_data_digest_mutex);
+        m_data_digest.clear();
+    }
+    if (m_data && m_data.use_count() > 1)
+    {
+        auto data = make_shared<runtime::AlignedBuffer>(m_data->size(), host_alignment());
+        memcpy(data->get_ptr(), m_data->get_ptr(), m_data->size());
+        m_data = data;
+    }
+    return (m_data ? m_data->get_ptr() : nullptr);
+}
+
 shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<Constant>(m_element_type, m_shape, m_data->get_ptr());
+    return make_shared<Constant>(m_element_type, m_shape, m_data);
 }
 
 template <typename T>
@@ -336,7 +435,7 @@ constexpr NodeTypeInfo op::ScalarConstantLikeBase::type_info;
 
 shared_ptr<op::Constant> op::ScalarConstantLikeBase::as_constant() const
 {
-    return std::make_shared<op::Constant>(m_element_type, m_shape, m_data->get_ptr());
+    return std::make_shared<op::Constant>(m_element_type, m_shape, m_data);
 }
 
 std::shared_ptr<Node> op::ScalarConstantLike::copy_with_new_args(const NodeVector& new_args) const
@@ -373,3 +472,57 @@ namespace ngraph
         }
     }
 }
+
+size_t op::Constant::get_attribute_hash() const
+{
+    // FNV-1a taken a word at a time, so that large weights are cheap to hash
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t digest = 0xcbf29ce484222325ULL;
+    const char* data = static_cast<const char*>(get_data_ptr());
+    size_t size = shape_size(m_shape) * m_element_type.size();
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        digest = (digest ^ word) * prime;
+    }
+    for (; i < size; i++)
+    {
+        digest = (digest ^ static_cast<uint8_t>(data[i])) * prime;
+    }
+    // The multiplications only carry low bits upwards, fold the high bits back down
+    digest ^= digest >> 32;
+
+    vector<size_t> values{static_cast<size_t>(digest), m_element_type.hash()};
+    values.insert(values.end(), m_shape.begin(), m_shape.end());
+    return hash_combine(values);
+}
+
+string op::Constant::get_data_digest() const
+{
+    lock_guard<mutex> lock(m_data_digest_mutex);
+    if (m_data_digest.empty())
+    {
+        SHA256 digest;
+        digest.update(get_data_ptr(), shape_size(m_shape) * m_element_type.size());
+        m_data_digest = digest.get_hex();
+    }
+    return m_data_digest;
+}
+
+bool op::Constant::has_same_attributes(const Node& other) const
+{
+    if (typeid(*this) != typeid(other))
+    {
+        return false;
+    }
+    auto& constant = static_cast<const Constant&>(other);
+    if (m_element_type != constant.m_element_type || m_shape != constant.m_shape)
+    {
+        return false;
+    }
+    size_t size = shape_size(m_shape) * m_element_type.size();
+    return size == 0 || m_data == constant.m_data ||
+           memcmp(get_data_ptr(), constant.get_data_ptr(), size) == 0;
+}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstring>
+#include <mutex>
 #include <sstream>
 
 #include "ngraph/coordinate_diff.hpp"
@@ -79,58 +80,9 @@ namespace ngraph
             /// \param type The element type of the tensor constant.
             /// \param shape The shape of the tensor constant.
             /// \param values A list of string values to use as the constant data.
-            Constant(const element::Type& type, Shape shape, const std::vector<std::string>& values)
-                : m_element_type(type)
-                , m_shape(shape)
-                , m_data(new runtime::AlignedBuffer(shape_size(m_shape) * m_element_type.size(),
-                                                    host_alignment()))
-            {
-                NODE_VALIDATION_CHECK(
-                    this,
-                    values.size() == shape_size(m_shape) || values.size() == 1,
-                    "Did not get the expected number of literals for a constant of shape ",
-                    m_shape,
-                    " (got ",
-                    values.size(),
-                    ", expected ",
-                    shape_size(m_shape),
-                    ".");
-                if (values.size())
-                {
-                    if (type.is_integral())
-                    {
-                        if (type.is_signed())
-                        {
-                            std::vector<int64_t> dvalues = parse_string<int64_t>(values);
-                            if (values.size() == 1 && shape_size(m_shape) != 1)
-                            {
-                                dvalues = std::vector<int64_t>(shape_size(m_shape), dvalues[0]);
-                            }
-                            write_values(dvalues);
-                        }
-                        else
-                        {
-                            std::vector<uint64_t> dvalues = parse_string<uint64_t>(values);
-                            if (values.size() == 1 && shape_size(m_shape) != 1)
-                            {
-                                dvalues = std::vector<uint64_t>(shape_size(m_shape), dvalues[0]);
-                            }
-                            write_values(dvalues);
-                        }
-                    }
-                    else
-                    {
-                        std::vector<double> dvalues = parse_string<double>(values);
-                        if (values.size() == 1 && shape_size(m_shape) != 1)
-                        {
-                            dvalues = std::vector<double>(shape_size(m_shape), dvalues[0]);
-                        }
-                        write_values(dvalues);
-                    }
-                }
-                constructor_validate_and_infer_types();
-                m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
-            }
+            Constant(const element::Type& type,
+                     Shape shape,
+                     const std::vector<std::string>& values);
 
             /// \brief Constructs a tensor constant with the same initialization value copied across
             //         the tensor. This constructor is to support deserialization of constants.
@@ -151,6 +103,17 @@ namespace ngraph
                 m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
             }
 
+            /// \brief Constructs a tensor constant that shares its data rather than copying it.
+            ///        Shared data is treated as immutable; a constant that needs to write to it
+            ///        takes a copy first.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data A buffer of at least shape_size(shape) * type.size() bytes.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const std::shared_ptr<runtime::AlignedBuffer>& data);
+
             virtual ~Constant() override;
 
             void validate_and_infer_types() override
@@ -248,6 +211,15 @@ namespace ngraph
             }
 
             bool is_constant() const override { return true; }
+            /// \brief Hashes the element type, shape and a digest of the data
+            size_t get_attribute_hash() const override;
+            /// \returns The SHA-256 digest of the data as 64 hex digits. It is computed the
+            /// first time it is asked for and kept until the data is written.
+            std::string get_data_digest() const;
+            /// \brief True if other is a Constant of the same element type and shape holding
+            /// the same data
+            bool has_same_attributes(const Node& other) const override;
+            bool has_serialized_attributes() const override { return false; }
             bool are_all_data_elements_bitwise_identical() const;
             bool get_all_data_elements_bitwise_identical() const
             {
@@ -256,7 +228,8 @@ namespace ngraph
             std::string convert_value_to_string(size_t index) const;
 
         protected:
-            void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
+            /// \brief Returns the data for writing, after copying it if it is shared
+            void* get_data_ptr_nc();
             Constant(const OutputVector& args)
                 : Op(args)
                 , m_shape({})
@@ -349,8 +322,11 @@ namespace ngraph
             static constexpr size_t host_alignment() { return 64; }
             element::Type m_element_type;
             Shape m_shape{};
-            std::unique_ptr<runtime::AlignedBuffer> m_data;
+            // Shared with the copies of this constant until one of them writes to it
+            std::shared_ptr<runtime::AlignedBuffer> m_data;
             bool m_all_elements_bitwise_identical;
+            mutable std::mutex m_data_digest_mutex;
+            mutable std::string m_data_digest;
             Constant(const Constant&) = delete;
             Constant operator=(const Constant&) = delete;
         };
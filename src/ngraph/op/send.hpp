@@ -43,6 +43,9 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
             int get_dest_id() const;
+            /// \brief Each Send moves a message of its own, so none stands in for another
+            bool has_same_attributes(const Node& /* other */) const override { return false; }
+            bool has_serialized_attributes() const override { return false; }
 
         private:
             int m_dest_id;
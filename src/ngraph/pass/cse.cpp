@@ -14,17 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
-#include <set>
+#include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "cse.hpp"
-#include "ngraph/axis_vector.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
-#include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/asin.hpp"
@@ -32,7 +31,6 @@
 #include "ngraph/op/atan2.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/ceiling.hpp"
-#include "ngraph/op/constant.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
 #include "ngraph/op/divide.hpp"
@@ -42,7 +40,6 @@
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
-#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/one_hot.hpp"
 #include "ngraph/op/power.hpp"
@@ -53,185 +50,205 @@
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
 #include "ngraph/op/sinh.hpp"
-#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
-#include "ngraph/pattern/matcher.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 #define TI(x) type_index(typeid(x))
 
-static bool cse_constant(shared_ptr<Node> a, shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_constant for " << a->get_name() << " and " << b->get_name();
-
-    if (a->get_shape() != b->get_shape() || a->get_element_type() != b->get_element_type())
-    {
-        return false;
-    }
-
-    auto ca = static_pointer_cast<op::Constant>(a);
-    auto cb = static_pointer_cast<op::Constant>(b);
-
-    size_t size = shape_size(a->get_shape()) * a->get_element_type().size();
-
-    return !memcmp(ca->get_data_ptr(), cb->get_data_ptr(), size);
-}
+using CSEHandlerMap =
+    unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>;
 
-static bool cse_reshape(shared_ptr<Node> a, shared_ptr<Node> b)
+// Attribute comparisons for common ops, used when the serializer is not built in. The inputs
+// are compared by NodeKey.
+static bool cse_no_attributes(shared_ptr<Node>, shared_ptr<Node>)
 {
-    NGRAPH_DEBUG << "In cse_reshape for " << a->get_name() << " and " << b->get_name();
-
-    auto reshape_a = static_pointer_cast<ngraph::op::Reshape>(a);
-    auto reshape_b = static_pointer_cast<ngraph::op::Reshape>(b);
-
-    return (a->input(0).get_source_output() == b->input(0).get_source_output()) &&
-           (reshape_a->get_input_order() == reshape_b->get_input_order()) &&
-           (reshape_a->get_output_shape() == reshape_b->get_output_shape());
+    return true;
 }
-static bool cse_broadcast(shared_ptr<Node> a, shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_broadcast for " << a->get_name() << " and " << b->get_name();
 
-    auto broadcast_a = static_pointer_cast<ngraph::op::Broadcast>(a);
-    auto broadcast_b = static_pointer_cast<ngraph::op::Broadcast>(b);
-
-    return (a->input(0).get_source_output() == b->input(0).get_source_output()) &&
-           (broadcast_a->get_broadcast_axes() == broadcast_b->get_broadcast_axes()) &&
-           (broadcast_a->get_broadcast_shape() == broadcast_b->get_broadcast_shape());
-}
-static bool cse_unarywise(shared_ptr<Node> a, shared_ptr<Node> b)
+static bool cse_binary_elementwise(shared_ptr<Node> a, shared_ptr<Node> b)
 {
-    NGRAPH_DEBUG << "In cse_unarywise for " << a->get_name() << " and " << b->get_name();
-
-    return a->input(0).get_source_output() == b->input(0).get_source_output();
+    return a->get_autob() == b->get_autob();
 }
 
-static bool cse_binarywise(shared_ptr<Node> a, shared_ptr<Node> b)
+static bool cse_divide(shared_ptr<Node> a, shared_ptr<Node> b)
 {
-    NGRAPH_DEBUG << "In cse_binary for " << a->get_name() << " and " << b->get_name();
-
-    return (a->input(0).get_source_output() == b->input(0).get_source_output() &&
-            a->input(1).get_source_output() == b->input(1).get_source_output()) ||
-           (a->input(1).get_source_output() == b->input(0).get_source_output() &&
-            a->input(0).get_source_output() == b->input(1).get_source_output());
+    return a->get_autob() == b->get_autob() &&
+           static_pointer_cast<op::Divide>(a)->is_pythondiv() ==
+               static_pointer_cast<op::Divide>(b)->is_pythondiv();
 }
 
 static bool cse_reduction(shared_ptr<Node> a, shared_ptr<Node> b)
 {
-    NGRAPH_DEBUG << "In cse_reduction for " << a->get_name() << " and " << b->get_name();
-
     auto ar_a = static_pointer_cast<op::util::ArithmeticReduction>(a);
     auto ar_b = static_pointer_cast<op::util::ArithmeticReduction>(b);
-
-    return ar_a->input(0).get_source_output() == ar_b->input(0).get_source_output() &&
-           ar_a->get_reduction_axes() == ar_b->get_reduction_axes();
+    return ar_a->get_reduction_axes() == ar_b->get_reduction_axes();
 }
 
-static bool cse_one_hot(shared_ptr<Node> a, shared_ptr<Node> b)
+static bool cse_reshape(shared_ptr<Node> a, shared_ptr<Node> b)
 {
-    NGRAPH_DEBUG << "In cse_one_hot for " << a->get_name() << " and " << b->get_name();
-
-    auto one_hot_a = static_pointer_cast<ngraph::op::OneHot>(a);
-    auto one_hot_b = static_pointer_cast<ngraph::op::OneHot>(b);
+    auto reshape_a = static_pointer_cast<op::Reshape>(a);
+    auto reshape_b = static_pointer_cast<op::Reshape>(b);
+    return reshape_a->get_input_order() == reshape_b->get_input_order() &&
+           reshape_a->get_output_shape() == reshape_b->get_output_shape();
+}
 
-    return (a->input(0).get_source_output() == b->input(0).get_source_output()) &&
-           (one_hot_a->get_one_hot_axis() == one_hot_b->get_one_hot_axis()) &&
-           (a->get_shape() == b->get_shape());
+static bool cse_broadcast(shared_ptr<Node> a, shared_ptr<Node> b)
+{
+    auto broadcast_a = static_pointer_cast<op::Broadcast>(a);
+    auto broadcast_b = static_pointer_cast<op::Broadcast>(b);
+    return broadcast_a->get_broadcast_axes() == broadcast_b->get_broadcast_axes() &&
+           broadcast_a->get_broadcast_shape() == broadcast_b->get_broadcast_shape();
 }
-static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
-    initialize_ops_to_cse_handlers()
+
+static bool cse_one_hot(shared_ptr<Node> a, shared_ptr<Node> b)
 {
-    return unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>(
-        {{TI(op::Abs), cse_unarywise},
-         {TI(op::Acos), cse_unarywise},
-         {TI(op::Asin), cse_unarywise},
-         {TI(op::Atan), cse_unarywise},
-         {TI(op::Atan2), cse_binarywise},
-         {TI(op::Ceiling), cse_unarywise},
-         {TI(op::Constant), cse_constant},
-         {TI(op::Cos), cse_unarywise},
-         {TI(op::Cosh), cse_unarywise},
-         {TI(op::Exp), cse_unarywise},
-         {TI(op::Floor), cse_unarywise},
-         {TI(op::Log), cse_unarywise},
-         {TI(op::Negative), cse_unarywise},
-         {TI(op::OneHot), cse_one_hot},
-         {TI(op::Relu), cse_unarywise},
-         {TI(op::Sigmoid), cse_unarywise},
-         {TI(op::Sign), cse_unarywise},
-         {TI(op::Sin), cse_unarywise},
-         {TI(op::Sinh), cse_unarywise},
-         //{TI(op::Softmax), cse_unarywise},
-         {TI(op::Sqrt), cse_unarywise},
-         {TI(op::Tan), cse_unarywise},
-         {TI(op::Tanh), cse_unarywise},
-         {TI(op::Add), cse_binarywise},
-         {TI(op::Divide), cse_binarywise},
-         {TI(op::Maximum), cse_binarywise},
-         {TI(op::Minimum), cse_binarywise},
-         {TI(op::Multiply), cse_binarywise},
-         {TI(op::Power), cse_binarywise},
-         {TI(op::Subtract), cse_binarywise},
-         {TI(op::Sum), cse_reduction},
-         {TI(op::Product), cse_reduction},
-         {TI(op::Reshape), cse_reshape},
-         {TI(op::Broadcast), cse_broadcast}});
+    auto one_hot_a = static_pointer_cast<op::OneHot>(a);
+    auto one_hot_b = static_pointer_cast<op::OneHot>(b);
+    return one_hot_a->get_one_hot_axis() == one_hot_b->get_one_hot_axis() &&
+           a->get_output_shape(0) == b->get_output_shape(0);
 }
 
-static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
-    ops_to_cse_handlers = initialize_ops_to_cse_handlers();
+static const CSEHandlerMap& get_fallback_handlers()
+{
+    static const CSEHandlerMap handlers{{TI(op::Abs), cse_no_attributes},
+                                        {TI(op::Acos), cse_no_attributes},
+                                        {TI(op::Asin), cse_no_attributes},
+                                        {TI(op::Atan), cse_no_attributes},
+                                        {TI(op::Ceiling), cse_no_attributes},
+                                        {TI(op::Cos), cse_no_attributes},
+                                        {TI(op::Cosh), cse_no_attributes},
+                                        {TI(op::Exp), cse_no_attributes},
+                                        {TI(op::Floor), cse_no_attributes},
+                                        {TI(op::Log), cse_no_attributes},
+                                        {TI(op::Negative), cse_no_attributes},
+                                        {TI(op::Relu), cse_no_attributes},
+                                        {TI(op::Sigmoid), cse_no_attributes},
+                                        {TI(op::Sign), cse_no_attributes},
+                                        {TI(op::Sin), cse_no_attributes},
+                                        {TI(op::Sinh), cse_no_attributes},
+                                        {TI(op::Sqrt), cse_no_attributes},
+                                        {TI(op::Tan), cse_no_attributes},
+                                        {TI(op::Tanh), cse_no_attributes},
+                                        {TI(op::Add), cse_binary_elementwise},
+                                        {TI(op::Atan2), cse_binary_elementwise},
+                                        {TI(op::Divide), cse_divide},
+                                        {TI(op::Maximum), cse_binary_elementwise},
+                                        {TI(op::Minimum), cse_binary_elementwise},
+                                        {TI(op::Multiply), cse_binary_elementwise},
+                                        {TI(op::Power), cse_binary_elementwise},
+                                        {TI(op::Subtract), cse_binary_elementwise},
+                                        {TI(op::Sum), cse_reduction},
+                                        {TI(op::Product), cse_reduction},
+                                        {TI(op::Reshape), cse_reshape},
+                                        {TI(op::Broadcast), cse_broadcast},
+                                        {TI(op::OneHot), cse_one_hot}};
+    return handlers;
+}
 
+// Two nodes are the same expression if they are the same op with the same attributes and the
+// same inputs, in any order for commutative ops. Ops with a backend handler are compared by
+// the handler alone.
+//
+// The attributes of most ops are what the serializer writes for them. They are serialized
+// once per node, when its key is made, and the strings are compared from then on. Ops that
+// compare their attributes themselves, such as Constant, are asked instead. Without the
+// serializer, the common ops above are still compared by their own handlers.
 class NodeKey
 {
 public:
-    NodeKey(shared_ptr<Node> n,
-            unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-                backend_handlers)
+    NodeKey(const shared_ptr<Node>& n, const CSEHandlerMap& backend_handlers)
         : m_node(n)
-        , m_backend_handlers(backend_handlers)
+        , m_backend_handler(nullptr)
+        , m_fallback_handler(nullptr)
+        , m_comparable(true)
     {
-    }
-
-    shared_ptr<Node> get_node() const { return m_node; }
-    bool operator==(const NodeKey& other) const
-    {
-        Node& p_this = *m_node.get();
-        Node& p_other = *other.get_node().get();
-
-        if (TI(p_this) != TI(p_other))
+        auto eh = backend_handlers.find(TI(*n));
+        if (eh != backend_handlers.end())
         {
-            return false;
+            m_backend_handler = &eh->second;
         }
 
+        for (auto input : n->inputs())
         {
-            auto eh = ops_to_cse_handlers.find(TI(p_this));
-            if (eh != ops_to_cse_handlers.end())
-            {
-                return eh->second(m_node, other.get_node());
-            }
+            m_args.push_back(input.get_source_output());
+        }
+        if (n->is_commutative())
+        {
+            sort(m_args.begin(), m_args.end());
         }
 
+        vector<size_t> values{hash<type_index>()(TI(*n))};
+        if (!m_backend_handler && n->has_state())
+        {
+            m_comparable = false;
+        }
+        else if (!m_backend_handler && !n->has_serialized_attributes())
         {
-            auto eh = m_backend_handlers.find(TI(p_this));
-            if (eh != m_backend_handlers.end())
+            values.push_back(n->get_attribute_hash());
+        }
+        else if (!m_backend_handler)
+        {
+            m_attributes = serialize_node_attributes(*n);
+            if (m_attributes.empty())
             {
-                return eh->second(m_node, other.get_node());
+                auto fh = get_fallback_handlers().find(TI(*n));
+                m_comparable = fh != get_fallback_handlers().end();
+                m_fallback_handler = m_comparable ? &fh->second : nullptr;
             }
+            values.push_back(hash<string>()(m_attributes));
         }
+        for (auto& arg : m_args)
+        {
+            values.push_back(arg.get_node()->get_instance_id());
+            values.push_back(arg.get_index());
+        }
+        m_hash = hash_combine(values);
+    }
 
-        return false;
+    const shared_ptr<Node>& get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
+    bool operator==(const NodeKey& other) const
+    {
+        if (m_hash != other.m_hash || TI(*m_node) != TI(*other.m_node) || !m_comparable ||
+            !other.m_comparable)
+        {
+            return false;
+        }
+        if (m_backend_handler)
+        {
+            return (*m_backend_handler)(m_node, other.m_node);
+        }
+        if (m_args != other.m_args)
+        {
+            return false;
+        }
+        if (m_fallback_handler)
+        {
+            return (*m_fallback_handler)(m_node, other.m_node);
+        }
+        if (!m_node->has_serialized_attributes())
+        {
+            return m_node->has_same_attributes(*other.m_node);
+        }
+        return m_attributes == other.m_attributes;
     }
 
 private:
     shared_ptr<Node> m_node;
-    unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-        m_backend_handlers;
+    const function<bool(shared_ptr<Node>, shared_ptr<Node>)>* m_backend_handler;
+    const function<bool(shared_ptr<Node>, shared_ptr<Node>)>* m_fallback_handler;
+    bool m_comparable;
+    vector<Output<Node>> m_args;
+    string m_attributes;
+    size_t m_hash;
 };
 
 namespace std
@@ -239,40 +256,7 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            hash<type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            std::vector<Output<Node>> cargs;
-            for (auto input : k.get_node()->inputs())
-            {
-                cargs.push_back(input.get_source_output());
-            }
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg.get_node_shared_ptr()->get_instance_id());
-                arg_ids.push_back(arg.get_index());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
@@ -289,9 +273,12 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(shared_ptr<ng
         }
 
         NodeKey n_key(n, m_backend_cse_handlers);
-        if (expressions.count(n_key))
+        auto it = expressions.find(n_key);
+        if (it != expressions.end())
         {
-            ngraph::replace_node(n, expressions.at(n_key));
+            NGRAPH_DEBUG << "CSE replaces " << n->get_name() << " with "
+                         << it->second->get_name();
+            ngraph::replace_node(n, it->second);
             replaced = true;
         }
         else
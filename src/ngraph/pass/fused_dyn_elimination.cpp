@@ -0,0 +1,43 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/fused_dyn_elimination.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+pass::FusedDynElimination::FusedDynElimination(const BuildNodeExecutorMap& cfmap)
+    : FunctionPass()
+    , m_constant_folding(cfmap)
+{
+    set_property(PassProperty::CHANGE_DYNAMIC_STATE, true);
+}
+
+bool pass::FusedDynElimination::rewrite_node(const shared_ptr<Node>& node,
+                                             const shared_ptr<Function>& f)
+{
+    // Same order as one round of the passes run one after the other
+    return m_constant_folding.apply_matchers(node, f) ||
+           m_dyn_elimination.apply_matchers(node, f) || m_opset0_downgrade.run_on_node(node);
+}
+
+bool pass::FusedDynElimination::run_on_function(shared_ptr<Function> f)
+{
+    // Only reached if rewrites undo each other
+    const size_t max_visits_per_node = 10;
+    auto rewrite = [&](const shared_ptr<Node>& node) { return rewrite_node(node, f); };
+    return rewrite_to_fixed_point(f, rewrite, max_visits_per_node);
+}
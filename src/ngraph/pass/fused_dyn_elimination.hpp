@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/dyn_elimination.hpp"
+#include "ngraph/pass/opset0_downgrade.hpp"
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class FusedDynElimination;
+    }
+}
+
+/// \brief Runs ConstantFolding, DynElimination and Opset0Downgrade together until none of
+/// them applies anywhere in the function.
+///
+/// Running the three passes one after the other needs several rounds, since each pass only
+/// sees the rewrites the others made on earlier rounds. This pass offers every node to all
+/// three with rewrite_to_fixed_point, which also visits the nodes each rewrite creates, so a
+/// single traversal reaches the fixed point.
+class ngraph::pass::FusedDynElimination : public FunctionPass
+{
+public:
+    FusedDynElimination(const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap());
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    bool rewrite_node(const std::shared_ptr<Node>& node, const std::shared_ptr<Function>& f);
+
+    ConstantFolding m_constant_folding;
+    DynElimination m_dyn_elimination;
+    Opset0Downgrade m_opset0_downgrade;
+};
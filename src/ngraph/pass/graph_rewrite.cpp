@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
 #include <regex>
 #include <unordered_set>
@@ -22,6 +23,7 @@
 
 #include "graph_rewrite.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -48,78 +50,263 @@ using namespace ngraph;
 // one.
 // If any Matcher succeeds the rest of the matchers will **not** be called.
 // E.g. if `m1` succeeds and replaces `Abs2` with a new constant, nor `m2` or `m3` will be called
-// However, sometimes, you will need more than one fusion occur on the same node.
+// Instead, the nodes created by the callback are visited next, with all the matchers, and so
+// are the arguments of the new nodes and the users of the replaced node if they were visited
+// already. E.g. the new constant replacing `Abs2` is offered to `m1`, `m2` and `m3` before
+// `Neg3` is visited. This way a pass reaches its fixed point without sorting and sweeping the
+// whole graph again; see rewrite_to_fixed_point.
+// However, sometimes, you will need a fusion to apply only after all the others.
 // In this case, you should be able to request another pass of GraphRewrite.
 // To request another pass, you will need to register fusions in a callback:
 // i.e. you will need to pass `this` into a callback and then call `this->construct_X`
 // This will schedule another pass of GraphRewrite with the following fusion.
 // This approach should only be used if you are either:
-// a) need more than one fusion occur on the same node
+// a) need a fusion to see the graph after all the other fusions
 // b) you are modifying nodes after the current node in the topological order
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
 
-bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
+// This check is very expensive and is only needed for experimental features, so we will hide
+// it behind an environment variable for now. TODO: Find a less expensive way to handle this.
+static bool rerun_dynamic_check()
 {
-    bool rewritten = false;
-    const size_t NUM_TRIES = 10;
-    size_t tries = NUM_TRIES;
-    vector<MatchClosure> original_matchers{m_matchers};
-    // This check is very expensive and is only needed for experimental features, so we will hide
-    // it behind an environment variable for now. TODO: Find a less expensive way to handle this.
     static bool s_rerun_dynamic_check =
         (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
-    bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
-    do
+    return s_rerun_dynamic_check;
+}
+
+bool pass::rewrite_to_fixed_point(const shared_ptr<Function>& f,
+                                  const function<bool(const shared_ptr<Node>&)>& rewrite_node,
+                                  size_t max_visits_per_node)
+{
+    // Nodes are tracked by instance id, which unlike addresses is never reused for the nodes
+    // the rewrites create
+    unordered_set<size_t> known;
+    unordered_set<size_t> pending;
+    deque<shared_ptr<Node>> worklist;
+    for (auto& node : f->get_ordered_ops())
     {
-        rewritten = false;
-        // m_matchers may contain newly constructed matchers for matchers
-        // that need multiple passes. See comments above.
-        vector<MatchClosure> matchers_to_run{m_matchers};
-        m_matchers.clear();
-        for (auto node : f->get_ordered_ops())
+        known.insert(node->get_instance_id());
+        pending.insert(node->get_instance_id());
+        worklist.push_back(node);
+    }
+
+    bool rewritten = false;
+    size_t visits = 0;
+    while (!worklist.empty())
+    {
+        // Rewrites that undo each other would otherwise never stop
+        if (visits++ > max_visits_per_node * known.size())
         {
-            if (m_enable_shape_inference)
-            {
-                node->revalidate_and_infer_types();
-            }
-            for (auto& closure : matchers_to_run)
+            NGRAPH_DEBUG << "Giving up on reaching a fixed point after " << visits << " visits";
+            break;
+        }
+
+        shared_ptr<Node> node = worklist.front();
+        worklist.pop_front();
+        pending.erase(node->get_instance_id());
+
+        NodeVector users = node->get_users();
+        if (!rewrite_node(node))
+        {
+            continue;
+        }
+        rewritten = true;
+
+        // The nodes created by the rewrite are visited next, preceded by the arguments they
+        // take from the rest of the graph and followed by the former users of node. Nodes still
+        // in the worklist stay where they are, behind everything they depend on.
+        vector<shared_ptr<Node>> walked;
+        unordered_set<size_t> created;
+        for (auto& user : users)
+        {
+            // Depth first walk from user through the nodes the rewrite created, collecting them
+            // arguments first
+            vector<shared_ptr<Node>> stack{user};
+            while (!stack.empty())
             {
-                if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+                shared_ptr<Node> n = stack.back();
+                bool args_done = true;
+                for (auto& arg : n->get_arguments())
                 {
-                    NGRAPH_DEBUG << "matcher callback requires static shape but the "
-                                    "function is dynamic, skipping this "
-                                    "optimization till the shapes are fully "
-                                    "materialized";
-                    continue;
+                    if (known.count(arg->get_instance_id()) == 0)
+                    {
+                        stack.push_back(arg);
+                        args_done = false;
+                        break;
+                    }
                 }
-                NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
-                             << closure.matcher->get_pattern()->get_name() << ") on "
-                             << node->get_name();
-                if (closure.matcher->match(node))
+                if (args_done)
                 {
-                    NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
-                                 << " matched " << node->get_name();
-                    if (closure.callback(*closure.matcher.get()))
+                    stack.pop_back();
+                    if (known.insert(n->get_instance_id()).second)
                     {
-                        rewritten = true;
-                        // If call back may change function's is_dynamic state, we need to
-                        // update the cached value.
-                        if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
-                        {
-                            is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
-                        }
-                        break;
+                        created.insert(n->get_instance_id());
                     }
+                    walked.push_back(n);
                 }
             }
         }
 
-    } while (rewritten && m_matchers.size() > 0 && tries--);
+        deque<shared_ptr<Node>> next;
+        for (auto& n : walked)
+        {
+            if (created.count(n->get_instance_id()) == 0)
+            {
+                continue;
+            }
+            for (auto& arg : n->get_arguments())
+            {
+                // node itself is left alone in case the rewrite wrapped it in a new node
+                if (created.count(arg->get_instance_id()) == 0 && arg != node &&
+                    pending.insert(arg->get_instance_id()).second)
+                {
+                    next.push_back(arg);
+                }
+            }
+        }
+        for (auto& n : walked)
+        {
+            if (pending.insert(n->get_instance_id()).second)
+            {
+                next.push_back(n);
+            }
+        }
+        worklist.insert(worklist.begin(), next.begin(), next.end());
+    }
+    return rewritten;
+}
+
+bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
+{
+    bool rewritten = false;
+    const size_t NUM_TRIES = 10;
+    vector<MatchClosure> original_matchers{m_matchers};
+    bool is_dyn_func = rerun_dynamic_check() && f->is_dynamic();
+    for (size_t tries = 0; tries < NUM_TRIES && m_matchers.size() > 0; tries++)
+    {
+        // m_matchers may contain newly constructed matchers for matchers
+        // that need multiple passes. See comments above.
+        MatcherIndex matchers_to_run(m_matchers);
+        m_matchers.clear();
+        m_index.reset();
+        if (!rewrite_to_fixed_point(f,
+                                    [&](const shared_ptr<Node>& node) {
+                                        return apply_matchers(
+                                            matchers_to_run, node, f, is_dyn_func);
+                                    },
+                                    NUM_TRIES))
+        {
+            break;
+        }
+        rewritten = true;
+    }
 
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
-    return (NUM_TRIES - tries) > 1; // this means a graph was transformed
+    m_index.reset();
+    return rewritten;
+}
+
+bool pass::GraphRewrite::apply_matchers(const shared_ptr<Node>& node,
+                                        const shared_ptr<Function>& f)
+{
+    if (!m_index)
+    {
+        m_index = make_shared<MatcherIndex>(m_matchers);
+    }
+    // Keeps the index alive if a callback adds a matcher
+    shared_ptr<MatcherIndex> index = m_index;
+    bool is_dyn_func = rerun_dynamic_check() && f->is_dynamic();
+    return apply_matchers(*index, node, f, is_dyn_func);
+}
+
+bool pass::GraphRewrite::apply_matchers(MatcherIndex& index,
+                                        const shared_ptr<Node>& node,
+                                        const shared_ptr<Function>& f,
+                                        bool& is_dyn_func)
+{
+    if (m_enable_shape_inference)
+    {
+        node->revalidate_and_infer_types();
+    }
+    for (size_t matcher_index : index.get_candidates(type_index(typeid(*node))))
+    {
+        auto& closure = index.get_matchers()[matcher_index];
+        if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+        {
+            NGRAPH_DEBUG << "matcher callback requires static shape but the "
+                            "function is dynamic, skipping this "
+                            "optimization till the shapes are fully "
+                            "materialized";
+            continue;
+        }
+        NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
+                     << closure.matcher->get_pattern()->get_name() << ") on "
+                     << node->get_name();
+        if (closure.matcher->match(node))
+        {
+            NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
+                         << " matched " << node->get_name();
+            if (closure.callback(*closure.matcher.get()))
+            {
+                // If call back may change function's is_dynamic state, we need to
+                // update the cached value.
+                if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+                {
+                    is_dyn_func = rerun_dynamic_check() && f->is_dynamic();
+                }
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+pass::GraphRewrite::MatcherIndex::MatcherIndex(const vector<MatchClosure>& matchers)
+    : m_matchers(matchers)
+{
+    for (size_t i = 0; i < matchers.size(); i++)
+    {
+        // Matcher::match only matches an op at the pattern root to a node of exactly the same
+        // type, see Matcher::match_node
+        Node* root = matchers[i].matcher->get_pattern().get();
+        if (dynamic_cast<pattern::op::Pattern*>(root) != nullptr)
+        {
+            m_any_type.push_back(i);
+        }
+        else
+        {
+            m_by_type[type_index(typeid(*root))].push_back(i);
+        }
+    }
+}
+
+const vector<size_t>&
+    pass::GraphRewrite::MatcherIndex::get_candidates(const type_index& type)
+{
+    auto it = m_candidates.find(type);
+    if (it == m_candidates.end())
+    {
+        // Merge the matchers for this type with the ones for any type, keeping the order the
+        // matchers were added in since the first callback that succeeds wins
+        vector<size_t> candidates;
+        auto by_type = m_by_type.find(type);
+        if (by_type == m_by_type.end())
+        {
+            candidates = m_any_type;
+        }
+        else
+        {
+            merge(by_type->second.begin(),
+                  by_type->second.end(),
+                  m_any_type.begin(),
+                  m_any_type.end(),
+                  back_inserter(candidates));
+        }
+        it = m_candidates.emplace(type, move(candidates)).first;
+    }
+    return it->second;
 }
 
 static vector<regex> initialize_fusion_regexes()
@@ -163,6 +350,7 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
     if (is_enabled(m))
     {
         m_matchers.push_back({m, callback, property});
+        m_index.reset();
         // If any matcher call back may change dynamic state, we need to
         // update the pass property.
         if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -208,13 +396,8 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
     bool changed = false;
     size_t i = 0;
 
-    // This check is very expensive and is only needed for experimental features, so we will hide
-    // it behind an environment variable for now. TODO: Find a less expensive way to handle this.
-    static bool s_rerun_dynamic_check =
-        (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
-
     auto run_matchers = [&]() -> bool {
-        bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+        bool is_dyn_func = rerun_dynamic_check() && f->is_dynamic();
         for (auto node : f->get_ops())
         {
             for (auto& closure : m_matchers)
@@ -238,7 +421,7 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
                         // update the cached value.
                         if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
                         {
-                            is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+                            is_dyn_func = rerun_dynamic_check() && f->is_dynamic();
                         }
                         return true;
                     }
@@ -19,6 +19,8 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <typeindex>
+#include <unordered_map>
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -29,6 +31,18 @@ namespace ngraph
     {
         class GraphRewrite;
         class RecurrentGraphRewrite;
+
+        /// \brief Offers the nodes of f, in topological order, to rewrite_node, which returns
+        /// true if it changed the graph. After a change, the nodes it created are offered next,
+        /// along with the arguments of those nodes and the users of the rewritten node if they
+        /// were offered already. This reaches a fixed point in a single traversal of f.
+        /// \param max_visits_per_node Gives up after this many visits per node on average,
+        ///    in case two rewrites keep undoing each other
+        /// \returns true if rewrite_node changed the graph
+        bool rewrite_to_fixed_point(
+            const std::shared_ptr<Function>& f,
+            const std::function<bool(const std::shared_ptr<Node>&)>& rewrite_node,
+            size_t max_visits_per_node);
     }
 
     using graph_rewrite_callback = std::function<bool(ngraph::pattern::Matcher& m)>;
@@ -68,6 +82,12 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Offers node, which must belong to f, to the matchers in the order they were added
+    /// and stops at the first callback that rewrites the graph. This is for passes that drive
+    /// their own traversal over the matchers of one or more GraphRewrites.
+    /// \returns true if a callback rewrote the graph
+    bool apply_matchers(const std::shared_ptr<Node>& node, const std::shared_ptr<Function>& f);
+
 protected:
     bool is_enabled(const std::shared_ptr<pattern::Matcher>& m) const;
     bool m_enable_shape_inference = false;
@@ -79,7 +99,36 @@ private:
         ngraph::graph_rewrite_callback callback;
         PassPropertyMask property;
     };
+
+    /// \brief A copy of the matchers of a GraphRewrite grouped by the op type at the root of
+    /// their pattern, so that a node is only offered to the matchers that can match it.
+    /// Patterns rooted at a Label, Any, AnyOf or Skip can match any node.
+    class MatcherIndex
+    {
+    public:
+        explicit MatcherIndex(const std::vector<MatchClosure>& matchers);
+
+        const std::vector<MatchClosure>& get_matchers() const { return m_matchers; }
+        /// \returns The positions in get_matchers() of the matchers for nodes of type, in the
+        /// order they were added
+        const std::vector<size_t>& get_candidates(const std::type_index& type);
+
+    private:
+        std::vector<MatchClosure> m_matchers;
+        std::vector<size_t> m_any_type;
+        std::unordered_map<std::type_index, std::vector<size_t>> m_by_type;
+        std::unordered_map<std::type_index, std::vector<size_t>> m_candidates;
+    };
+
+    bool apply_matchers(MatcherIndex& index,
+                        const std::shared_ptr<Node>& node,
+                        const std::shared_ptr<Function>& f,
+                        bool& is_dyn_func);
+
     std::vector<MatchClosure> m_matchers;
+    // Index of m_matchers for the public apply_matchers, built on first use. Callbacks may
+    // add matchers, so the index keeps its own copy.
+    std::shared_ptr<MatcherIndex> m_index;
 };
 
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
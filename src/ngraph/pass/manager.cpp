@@ -19,7 +19,7 @@
 #else
 #include <cxxabi.h>
 #endif
-#include <iomanip>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 
@@ -30,11 +30,27 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/chrome_trace.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
 pass::Manager::Manager()
 {
     static const auto nevt = std::getenv("NGRAPH_ENABLE_VISUALIZE_TRACING");
@@ -47,6 +63,8 @@ pass::Manager::Manager()
     {
         m_serialize = true;
     }
+    static const bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    m_profile_enabled = profile_enabled;
 }
 
 pass::Manager::~Manager()
@@ -55,7 +73,18 @@ pass::Manager::~Manager()
 
 void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
 {
-    static bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    static const bool print_profile = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    bool profile = m_profile_enabled || runtime::event::Manager::is_tracing_enabled();
+    size_t node_count = 0;
+    if (profile)
+    {
+        node_count = func->get_ops().size();
+        m_profile.reset(func->get_graph_size());
+    }
+    else
+    {
+        m_profile.reset(0);
+    }
 
     get_state().set_function(func);
     vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
@@ -63,10 +92,12 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
 
     size_t index = 0;
     stopwatch pass_timer;
-    stopwatch overall_timer;
-    overall_timer.start();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        string pass_name = profile ? get_pass_name(*pass) : "";
+        runtime::event::Duration trace_event(pass_name, "Pass");
+        size_t graph_version = Node::get_graph_version();
+        bool pass_modified = false;
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -79,7 +110,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
             {
                 vt_pass->set_ops_to_details(get_state().get_visualize_tree_ops_map());
             }
-            module_pass->run_on_module(f_array);
+            pass_modified = module_pass->run_on_module(f_array);
         }
         else if (function_pass)
         {
@@ -95,6 +126,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                     continue;
                 }
                 bool function_modified = function_pass->run_on_function(f);
+                pass_modified |= function_modified;
                 // If the pass may change the function's is_dynamic property, we need to
                 // update the cached value.
                 if (function_modified &&
@@ -115,7 +147,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                 }
                 for (shared_ptr<Node> n : f->get_ops())
                 {
-                    node_pass->run_on_node(n);
+                    pass_modified |= node_pass->run_on_node(n);
                 }
             }
         }
@@ -130,6 +162,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                     continue;
                 }
                 bool function_modified = call_graph_pass->run_on_call_graph(f->get_ordered_ops());
+                pass_modified |= function_modified;
                 f_pair.second = (function_modified == true) ? f->is_dynamic() : f_pair.second;
             }
         }
@@ -160,20 +193,27 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         }
         index++;
         pass_timer.stop();
-        if (profile_enabled)
+        trace_event.stop();
+        if (profile)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            PassProfile::Entry entry;
+            entry.name = pass_name;
+            entry.microseconds = pass_timer.get_microseconds();
+            entry.node_count_before = node_count;
+            node_count = func->get_ops().size();
+            entry.node_count_after = node_count;
+            entry.changed = pass_modified || Node::get_graph_version() != graph_version;
+            entry.graph_size = func->get_graph_size();
+            m_profile.add_entry(entry);
+            trace_event.set_args("{\"nodes_before\":" + to_string(entry.node_count_before) +
+                                 ",\"nodes_after\":" + to_string(entry.node_count_after) +
+                                 ",\"changed\":" + (entry.changed ? "true" : "false") +
+                                 ",\"graph_size\":" + to_string(entry.graph_size) + "}");
         }
     }
-    if (profile_enabled)
+    if (print_profile && profile)
     {
-        cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        cout << m_profile;
     }
 }
 
@@ -24,6 +24,7 @@
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/pass/validate.hpp"
 
 namespace ngraph
@@ -60,6 +61,13 @@ public:
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Record a PassProfile on each call to run_passes. Also enabled by
+    /// NGRAPH_PROFILE_PASS_ENABLE, which prints the profile, and by NGRAPH_ENABLE_TRACING,
+    /// which adds an event per pass to the chrome trace.
+    void set_pass_profiling(bool new_state) { m_profile_enabled = new_state; }
+    /// \returns The profile of the last call to run_passes, empty if profiling was off
+    const PassProfile& get_profile() const { return m_profile; }
+
 private:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args)
@@ -88,7 +96,9 @@ private:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     ManagerState m_state;
     PassConfig m_pass_config;
+    PassProfile m_profile;
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
+    bool m_profile_enabled = false;
 };
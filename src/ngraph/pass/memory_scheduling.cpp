@@ -0,0 +1,279 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_scheduling.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Outputs of these nodes are not placed in the arena, see pass::Liveness
+static bool is_persistent(const Node* node)
+{
+    return node->is_parameter() || node->is_output() || node->is_constant();
+}
+
+static size_t get_tensor_size(const descriptor::Tensor& tensor)
+{
+    return tensor.get_partial_shape().is_static() ? tensor.size() : 0;
+}
+
+// The arena pass::Liveness and pass::MemoryLayout make for ops. In place annotations are not
+// taken into account, so this is an upper bound when ops reuse their inputs.
+static size_t get_pool_size(const list<shared_ptr<Node>>& ops, size_t alignment)
+{
+    unordered_map<descriptor::Tensor*, const Node*> last_use;
+    for (const shared_ptr<Node>& node : ops)
+    {
+        for (auto& input : node->inputs())
+        {
+            if (!is_persistent(input.get_source_output().get_node()))
+            {
+                last_use[&input.get_tensor()] = node.get();
+            }
+        }
+        if (!is_persistent(node.get()))
+        {
+            for (auto& output : node->outputs())
+            {
+                last_use[&output.get_tensor()] = node.get();
+            }
+        }
+    }
+
+    pass::MemoryManager mm(alignment);
+    unordered_map<descriptor::Tensor*, size_t> offsets;
+    for (const shared_ptr<Node>& node : ops)
+    {
+        if (!is_persistent(node.get()))
+        {
+            for (auto& output : node->outputs())
+            {
+                descriptor::Tensor* tensor = &output.get_tensor();
+                offsets[tensor] = mm.allocate(get_tensor_size(*tensor));
+            }
+        }
+        // Inputs and unused outputs are freed at the end of their last op
+        unordered_set<descriptor::Tensor*> freed;
+        for (auto& input : node->inputs())
+        {
+            descriptor::Tensor* tensor = &input.get_tensor();
+            auto it = last_use.find(tensor);
+            if (it != last_use.end() && it->second == node.get() && freed.insert(tensor).second)
+            {
+                mm.free(offsets.at(tensor));
+            }
+        }
+        if (!is_persistent(node.get()))
+        {
+            for (auto& output : node->outputs())
+            {
+                descriptor::Tensor* tensor = &output.get_tensor();
+                if (last_use.at(tensor) == node.get())
+                {
+                    mm.free(offsets.at(tensor));
+                }
+            }
+        }
+    }
+    return mm.max_allocated();
+}
+
+pass::MemoryScheduling::MemoryScheduling(size_t alignment)
+    : m_alignment(alignment)
+{
+}
+
+bool pass::MemoryScheduling::run_on_function(shared_ptr<Function> function)
+{
+    if (function->is_dynamic())
+    {
+        return false;
+    }
+
+    // The same root nodes Function::get_ordered_ops sorts
+    NodeVector root_nodes;
+    for (auto& result : function->get_results())
+    {
+        root_nodes.push_back(result);
+    }
+    for (auto& param : function->get_parameters())
+    {
+        root_nodes.push_back(param);
+    }
+
+    m_pool_size_before = get_pool_size(topological_sort(root_nodes, true), m_alignment);
+    m_pool_size_after = get_pool_size(sort(root_nodes, true), m_alignment);
+    NGRAPH_DEBUG << "MemoryScheduling " << function->get_name() << ": arena of "
+                 << m_pool_size_before << " bytes, " << m_pool_size_after << " bytes scheduled";
+    if (m_pool_size_after < m_pool_size_before)
+    {
+        function->set_topological_sort(sort);
+    }
+    else
+    {
+        m_pool_size_after = m_pool_size_before;
+    }
+    return false;
+}
+
+list<shared_ptr<Node>> pass::MemoryScheduling::sort(const NodeVector& root_nodes,
+                                                    bool include_control_deps)
+{
+    // Index the nodes in the default order, which also breaks ties between ready ops
+    list<shared_ptr<Node>> default_order = topological_sort(root_nodes, include_control_deps);
+    vector<shared_ptr<Node>> nodes(default_order.begin(), default_order.end());
+    size_t node_count = nodes.size();
+    unordered_map<const Node*, size_t> node_index;
+    for (size_t i = 0; i < node_count; i++)
+    {
+        node_index[nodes[i].get()] = i;
+    }
+
+    struct TensorInfo
+    {
+        int64_t m_size;
+        size_t m_producer;
+        // Distinct nodes reading the tensor, and how many of them have not run yet
+        vector<size_t> m_users;
+        size_t m_remaining_users;
+    };
+    vector<TensorInfo> tensors;
+    unordered_map<const descriptor::Tensor*, size_t> tensor_index;
+    vector<vector<size_t>> node_inputs(node_count);
+    vector<vector<size_t>> successors(node_count);
+    vector<size_t> pending_predecessors(node_count, 0);
+    // Bytes an op allocates for its outputs, and bytes freed once it has run
+    vector<int64_t> allocated(node_count, 0);
+    vector<int64_t> freed(node_count, 0);
+
+    for (size_t i = 0; i < node_count; i++)
+    {
+        Node* node = nodes[i].get();
+        unordered_set<const Node*> predecessors;
+        for (auto& input : node->inputs())
+        {
+            predecessors.insert(input.get_source_output().get_node());
+            auto it = tensor_index.find(&input.get_tensor());
+            if (it != tensor_index.end())
+            {
+                TensorInfo& tensor = tensors[it->second];
+                if (tensor.m_users.empty() || tensor.m_users.back() != i)
+                {
+                    tensor.m_users.push_back(i);
+                    tensor.m_remaining_users++;
+                    node_inputs[i].push_back(it->second);
+                }
+            }
+        }
+        if (include_control_deps)
+        {
+            for (auto& dependency : node->get_control_dependencies())
+            {
+                predecessors.insert(dependency.get());
+            }
+        }
+        for (const Node* predecessor : predecessors)
+        {
+            successors[node_index.at(predecessor)].push_back(i);
+            pending_predecessors[i]++;
+        }
+        if (!is_persistent(node))
+        {
+            for (auto& output : node->outputs())
+            {
+                int64_t size = get_tensor_size(output.get_tensor());
+                tensor_index[&output.get_tensor()] = tensors.size();
+                tensors.push_back({size, i, {}, 0});
+                allocated[i] += size;
+            }
+        }
+    }
+    for (const TensorInfo& tensor : tensors)
+    {
+        if (tensor.m_users.empty())
+        {
+            freed[tensor.m_producer] += tensor.m_size;
+        }
+        else if (tensor.m_users.size() == 1)
+        {
+            freed[tensor.m_users[0]] += tensor.m_size;
+        }
+    }
+
+    // Ready ops ordered by how much they grow the live memory, then by the default order
+    auto key = [&](size_t i) { return make_pair(allocated[i] - freed[i], i); };
+    set<pair<int64_t, size_t>> ready;
+    for (size_t i = 0; i < node_count; i++)
+    {
+        if (pending_predecessors[i] == 0)
+        {
+            ready.insert(key(i));
+        }
+    }
+
+    list<shared_ptr<Node>> result;
+    vector<bool> scheduled(node_count, false);
+    while (!ready.empty())
+    {
+        size_t i = ready.begin()->second;
+        ready.erase(ready.begin());
+        scheduled[i] = true;
+        result.push_back(nodes[i]);
+        for (size_t tensor_id : node_inputs[i])
+        {
+            TensorInfo& tensor = tensors[tensor_id];
+            if (--tensor.m_remaining_users != 1)
+            {
+                continue;
+            }
+            // Whichever user is left frees the tensor
+            for (size_t user : tensor.m_users)
+            {
+                if (!scheduled[user])
+                {
+                    bool is_ready = pending_predecessors[user] == 0;
+                    if (is_ready)
+                    {
+                        ready.erase(key(user));
+                    }
+                    freed[user] += tensor.m_size;
+                    if (is_ready)
+                    {
+                        ready.insert(key(user));
+                    }
+                    break;
+                }
+            }
+        }
+        for (size_t successor : successors[i])
+        {
+            if (--pending_predecessors[successor] == 0)
+            {
+                ready.insert(key(successor));
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <list>
+#include <memory>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemoryScheduling;
+    }
+}
+
+/// \brief Orders the ops of a function so that fewer temporary tensors are live at the same
+/// time, which shrinks the arena pass::MemoryLayout lays out for them.
+///
+/// Ops are scheduled greedily: of the ops whose inputs are ready, the one that grows the live
+/// memory least is run next, counting the inputs it is the last user of as freed. The order is
+/// installed with Function::set_topological_sort only if its arena is smaller than the one of
+/// the default order. Run it after the passes that change the graph and before pass::Liveness.
+class ngraph::pass::MemoryScheduling : public FunctionPass
+{
+public:
+    MemoryScheduling(size_t alignment = 1);
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+    /// \returns The arena size of the default order for the last function run on
+    size_t get_pool_size_before() const { return m_pool_size_before; }
+    /// \returns The arena size of the order the last function run on was left with
+    size_t get_pool_size_after() const { return m_pool_size_after; }
+
+    /// \brief Sorts the nodes root_nodes depend on to keep few temporaries alive. Suitable
+    /// for Function::set_topological_sort.
+    static std::list<std::shared_ptr<Node>> sort(const NodeVector& root_nodes,
+                                                 bool include_control_deps);
+
+private:
+    size_t m_alignment;
+    size_t m_pool_size_before = 0;
+    size_t m_pool_size_after = 0;
+};
@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <iomanip>
+
+#include "ngraph/pass/pass_profile.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+size_t pass::PassProfile::get_total_microseconds() const
+{
+    size_t total = 0;
+    for (const Entry& entry : m_entries)
+    {
+        total += entry.microseconds;
+    }
+    return total;
+}
+
+void pass::PassProfile::add_entry(const Entry& entry)
+{
+    m_entries.push_back(entry);
+    m_peak_graph_size = max(m_peak_graph_size, entry.graph_size);
+}
+
+void pass::PassProfile::reset(size_t graph_size)
+{
+    m_entries.clear();
+    m_peak_graph_size = graph_size;
+}
+
+ostream& pass::operator<<(ostream& out, const PassProfile& profile)
+{
+    for (const PassProfile::Entry& entry : profile.get_entries())
+    {
+        out << setw(10) << entry.microseconds << "us " << setw(8) << entry.node_count_before
+            << " -> " << setw(8) << left << entry.node_count_after << right
+            << (entry.changed ? " changed   " : " unchanged ") << entry.name << "\n";
+    }
+    out << "passes done in " << profile.get_total_microseconds() << "us, peak graph size "
+        << profile.get_peak_graph_size() << " bytes\n";
+    return out;
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class PassProfile;
+    }
+}
+
+/// \brief The compile-time cost of each pass run by a pass::Manager, recorded when pass
+/// profiling is enabled.
+///
+/// Node counts and graph sizes are taken from the function run_passes was called on; graph
+/// sizes are those of Function::get_graph_size.
+class ngraph::pass::PassProfile
+{
+public:
+    struct Entry
+    {
+        /// Demangled class name of the pass
+        std::string name;
+        /// Wall time of the pass, including any visualization or serialization it triggered
+        size_t microseconds;
+        size_t node_count_before;
+        size_t node_count_after;
+        /// True if the pass reported a change or edited any graph
+        bool changed;
+        /// Graph size once the pass has finished
+        size_t graph_size;
+    };
+
+    const std::vector<Entry>& get_entries() const { return m_entries; }
+    bool empty() const { return m_entries.empty(); }
+    size_t get_total_microseconds() const;
+    /// \returns The largest graph size seen before or after any pass
+    size_t get_peak_graph_size() const { return m_peak_graph_size; }
+    void add_entry(const Entry& entry);
+    /// \brief Starts a new report for a graph of the given size
+    void reset(size_t graph_size);
+
+private:
+    std::vector<Entry> m_entries;
+    size_t m_peak_graph_size = 0;
+};
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Writes the profile as a table, one line per pass
+        std::ostream& operator<<(std::ostream& out, const PassProfile& profile);
+    }
+}
@@ -22,6 +22,8 @@ namespace ngraph
 {
     namespace pass
     {
+        /// \brief Revalidates the nodes edited since they were last validated, and the nodes
+        /// whose input types changed as a result.
         class Validate : public FunctionPass
         {
         public:
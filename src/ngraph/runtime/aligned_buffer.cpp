@@ -55,6 +55,14 @@ runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment, Alloca
     }
 }
 
+runtime::AlignedBuffer::AlignedBuffer(void* data, size_t byte_size)
+    : m_allocator(nullptr)
+    , m_allocated_buffer(nullptr)
+    , m_aligned_buffer(static_cast<char*>(data))
+    , m_byte_size(byte_size)
+{
+}
+
 runtime::AlignedBuffer::AlignedBuffer(AlignedBuffer&& other)
     : m_allocator(other.m_allocator)
     , m_allocated_buffer(other.m_allocated_buffer)
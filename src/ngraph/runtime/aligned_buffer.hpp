@@ -39,6 +39,10 @@ public:
     // allocator exceeds the lifetime of this AlignedBuffer.
     AlignedBuffer(size_t byte_size, size_t alignment, Allocator* allocator = nullptr);
 
+    /// \brief Refers to byte_size bytes at data, which are owned elsewhere and are not freed
+    /// by this buffer.
+    AlignedBuffer(void* data, size_t byte_size);
+
     AlignedBuffer();
     ~AlignedBuffer();
 
@@ -118,6 +118,10 @@ public:
     /// This funtion has an implicit stop() if stop() has not been previously called
     void write();
 
+    /// \brief replace the args written with the event, for values only known once the
+    /// timed work is done
+    void set_args(const std::string& args) { m_args = args; }
+
     Duration(const Duration&) = delete;
     Duration& operator=(Duration const&) = delete;
 
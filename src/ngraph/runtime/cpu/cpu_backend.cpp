@@ -136,6 +136,7 @@ runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
         instance.m_external_function->m_emit_timing = performance_counters_enabled;
         auto cf = instance.m_external_function->make_call_frame(pass_config, allocator);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        set_compile_profile(instance.m_external_function->get_pass_profile());
     }
     set_parameters_and_results(*func);
 }
@@ -510,6 +510,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
     pass_manager.register_pass<ngraph::pass::CommonFunctionCollection>(
         femitter, node_function_map, common_function_string);
     pass_manager.run_passes(m_function);
+    m_pass_profile = pass_manager.get_profile();
 
     list<shared_ptr<Node>> ordered_ops = m_function->get_ordered_ops();
 
@@ -1443,6 +1444,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     }
     register_common_passes(pass_manager, pass_config);
     pass_manager.run_passes(m_function, false);
+    m_pass_profile = pass_manager.get_profile();
 
     static runtime::cpu::CPU_DebugTracer debug_tracer;
     if (std::getenv("NGRAPH_CPU_DEBUG_TRACER") != nullptr)
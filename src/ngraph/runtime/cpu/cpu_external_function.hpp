@@ -159,6 +159,10 @@ namespace ngraph
 
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
+                const ngraph::pass::PassProfile& get_pass_profile() const
+                {
+                    return m_pass_profile;
+                }
                 // Temporary Memory Pool alignment
                 static constexpr size_t s_memory_pool_alignment = 4096;
 
@@ -262,6 +266,7 @@ namespace ngraph
                     get_tensor_set(descriptor::Tensor* output_tensor);
 
                 std::shared_ptr<ngraph::Function> m_function;
+                ngraph::pass::PassProfile m_pass_profile;
                 bool m_release_function;
                 bool m_emit_timing;
 
@@ -27,10 +27,8 @@
 #include "ngraph/op/experimental/range.hpp"
 #include "ngraph/op/experimental/transpose.hpp"
 #include "ngraph/op/reshape.hpp"
-#include "ngraph/pass/constant_folding.hpp"
-#include "ngraph/pass/dyn_elimination.hpp"
+#include "ngraph/pass/fused_dyn_elimination.hpp"
 #include "ngraph/pass/manager.hpp"
-#include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/pass/shape_relevance.hpp"
 #include "ngraph/specialize_function.hpp"
 #include "ngraph/util.hpp"
@@ -70,12 +68,19 @@ shared_ptr<runtime::Executable>
         function, m_wrapped_backend, enable_performance_collection);
 }
 
+static size_t get_cache_capacity()
+{
+    static const char* env = std::getenv("NGRAPH_DYNAMIC_EXECUTABLE_CACHE_SIZE");
+    return env == nullptr ? 32 : parse_string<size_t>(env);
+}
+
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
                                                        shared_ptr<runtime::Backend> wrapped_backend,
                                                        bool enable_performance_collection)
     : m_wrapped_function(wrapped_function)
     , m_wrapped_backend(wrapped_backend)
     , m_enable_performance_collection(enable_performance_collection)
+    , m_cache_capacity(get_cache_capacity())
 {
     pass::Manager passes;
     passes.register_pass<pass::ShapeRelevance>();
@@ -97,7 +102,7 @@ bool is_dynamic_op(const std::shared_ptr<Node>& op)
            is_type<op::v1::GenerateMask>(op);
 }
 
-// Helper for a vile hack in DynamicExecutable::call. See body of that function for details.
+// Checks that specialization left no dynamic ops behind
 static size_t count_dyn_nodes(const shared_ptr<ngraph::Function>& f)
 {
     size_t count = 0;
@@ -115,122 +120,97 @@ bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
-    // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
-
     NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
 
     std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
     std::vector<element::Type> arg_element_types;
     std::vector<PartialShape> arg_shapes;
 
-    std::shared_ptr<Function> clone;
-    {
-        // We'll use AlignedBuffers to back the base pointers, storing them in this vector for RAII
-        // purposes.
-        std::vector<AlignedBuffer> arg_buffers;
-        arg_buffers.reserve(inputs.size());
-        std::vector<void*> arg_value_base_pointers(inputs.size());
+    // We'll use AlignedBuffers to back the base pointers, storing them in this vector for RAII
+    // purposes.
+    std::vector<AlignedBuffer> arg_buffers;
+    arg_buffers.reserve(inputs.size());
+    std::vector<void*> arg_value_base_pointers(inputs.size());
 
-        size_t i = 0;
+    // The cache key is made of every input's element type and shape, followed by the contents
+    // of the shape-relevant inputs
+    std::ostringstream key;
 
-        for (auto& input : inputs)
+    size_t i = 0;
+    for (auto& input : inputs)
+    {
+        if (auto dynamic_tensor = std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
         {
-            if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
-            {
-                // TODO(amprocte): Move has_storage() to runtime::Tensor?
-                if (auto dynamic_tensor =
-                        std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                {
-                    NGRAPH_CHECK(dynamic_tensor->has_storage());
-                }
-
-                arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
-                arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
-
-                // TODO(amprocte): For host-resident tensors we should be able to skip the read,
-                // but no API for that yet.
-                input->read(arg_value_base_pointers[i], input->get_size_in_bytes());
-            }
-            else
-            {
-                arg_value_base_pointers[i] = nullptr;
-            }
-
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-            {
-                NGRAPH_CHECK(dynamic_tensor->has_storage());
-                arg_element_types.push_back(
-                    dynamic_tensor->get_wrapped_tensor()->get_element_type());
-                arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
-                wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
-            }
-            else
-            {
-                arg_element_types.push_back(input->get_element_type());
-                arg_shapes.push_back(input->get_shape());
-                wrapped_inputs.push_back(input);
-            }
+            NGRAPH_CHECK(dynamic_tensor->has_storage());
+            arg_element_types.push_back(dynamic_tensor->get_wrapped_tensor()->get_element_type());
+            arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
+            wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
+        }
+        else
+        {
+            arg_element_types.push_back(input->get_element_type());
+            arg_shapes.push_back(input->get_shape());
+            wrapped_inputs.push_back(input);
+        }
+        key << arg_element_types.back() << arg_shapes.back() << ";";
 
-            i++;
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+        {
+            arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
+            arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
+
+            // TODO(amprocte): For host-resident tensors we should be able to skip the read,
+            // but no API for that yet.
+            input->read(arg_value_base_pointers[i], input->get_size_in_bytes());
+            key.write(static_cast<const char*>(arg_value_base_pointers[i]),
+                      input->get_size_in_bytes());
+        }
+        else
+        {
+            arg_value_base_pointers[i] = nullptr;
         }
 
-        clone = specialize_function(
-            m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+        i++;
     }
 
-    pass::Manager passes;
-    passes.register_pass<pass::ConstantFolding>();
-    passes.register_pass<pass::DynElimination>();
-    passes.register_pass<pass::Opset0Downgrade>(); // Converts dynamic v1 variants to v0 ops
-    passes.set_per_pass_validation(false);
-
-    // FIXME(amprocte): Vile, temporary hack: we need to do repeated rounds of
-    // ConstantFolding/DynElimination until everything that DynElimination is supposed to
-    // eliminate has actually been eliminated. We could do this by monitoring the return values of
-    // of the passes (keep iterating until both CF and DE report no changes), but that did not
-    // seem to work so here we are. Probably a better fix is to somehow combine the matchers in CF
-    // and DE into one pass.
-    size_t num_dyn_nodes_last_pass = std::numeric_limits<size_t>::max();
-
-    while (num_dyn_nodes_last_pass != 0)
+    std::shared_ptr<CachedExecutable> cached;
+    std::string cache_key = key.str();
     {
-        passes.run_passes(clone);
-        auto num_dyn_nodes_this_pass = count_dyn_nodes(clone);
-
-        NGRAPH_CHECK(num_dyn_nodes_this_pass < num_dyn_nodes_last_pass,
-                     "Could not eliminate all Dyn nodes (",
-                     num_dyn_nodes_this_pass,
-                     " remaining)");
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        auto it = m_cache_index.find(cache_key);
+        if (it != m_cache_index.end())
+        {
+            m_cache.splice(m_cache.begin(), m_cache, it->second);
+            cached = it->second->second;
+        }
+    }
+    if (!cached)
+    {
+        cached = compile_clone(arg_element_types, arg_shapes, arg_value_base_pointers);
 
-        num_dyn_nodes_last_pass = num_dyn_nodes_this_pass;
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        if (m_cache_capacity > 0 && m_cache_index.count(cache_key) == 0)
+        {
+            m_cache.emplace_front(cache_key, cached);
+            m_cache_index.insert({cache_key, m_cache.begin()});
+            while (m_cache.size() > m_cache_capacity)
+            {
+                m_cache_index.erase(m_cache.back().first);
+                m_cache.pop_back();
+            }
+        }
     }
 
-    pass::Manager pass_val;
-    pass_val.register_pass<pass::Validate>();
-    pass_val.run_passes(clone);
+    NGRAPH_CHECK(cached->m_result_shapes.size() == outputs.size());
 
     std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
-
-    const ResultVector& results = clone->get_results();
-    for (auto& result : results)
-    {
-        NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
-                     "Shape staticization failed for result node ",
-                     *result);
-    }
-    NGRAPH_CHECK(results.size() == outputs.size());
-
     for (size_t i = 0; i < outputs.size(); i++)
     {
         if (auto dynamic_tensor =
                 std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
         {
-            dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                         results[i]->get_output_shape(0));
+            dynamic_tensor->make_storage(cached->m_result_element_types[i],
+                                         cached->m_result_shapes[i]);
             wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
         }
         else
@@ -239,11 +219,45 @@ bool runtime::dynamic::DynamicExecutable::call(
         }
     }
 
-    // TODO: Put compiled executable in the cache.
-    auto compiled_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
-    auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
+    return cached->m_executable->call(wrapped_outputs, wrapped_inputs);
+}
+
+shared_ptr<runtime::dynamic::DynamicExecutable::CachedExecutable>
+    runtime::dynamic::DynamicExecutable::compile_clone(
+        const std::vector<element::Type>& arg_element_types,
+        const std::vector<PartialShape>& arg_shapes,
+        const std::vector<void*>& arg_value_base_pointers)
+{
+    std::shared_ptr<Function> clone = specialize_function(
+        m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+
+    pass::Manager passes;
+    passes.register_pass<pass::FusedDynElimination>();
+    passes.set_per_pass_validation(false);
+    passes.run_passes(clone);
+
+    auto num_dyn_nodes = count_dyn_nodes(clone);
+    NGRAPH_CHECK(num_dyn_nodes == 0,
+                 "Could not eliminate all Dyn nodes (",
+                 num_dyn_nodes,
+                 " remaining)");
+
+    pass::Manager pass_val;
+    pass_val.register_pass<pass::Validate>();
+    pass_val.run_passes(clone);
+
+    auto cached = make_shared<CachedExecutable>();
+    for (auto& result : clone->get_results())
+    {
+        NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
+                     "Shape staticization failed for result node ",
+                     *result);
+        cached->m_result_element_types.push_back(result->get_output_element_type(0));
+        cached->m_result_shapes.push_back(result->get_output_shape(0));
+    }
 
-    return result;
+    cached->m_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
+    return cached;
 }
 
 runtime::dynamic::DynamicTensor::DynamicTensor(
@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/runtime/backend.hpp"
@@ -86,6 +89,11 @@ private:
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// Compiled clones are cached, keyed by the element types and shapes of all inputs and the
+/// values of the shape-relevant inputs. A call whose inputs match an earlier one goes straight
+/// to the executable compiled for it. The least recently used clones are dropped once there
+/// are more than NGRAPH_DYNAMIC_EXECUTABLE_CACHE_SIZE (default 32) of them.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
@@ -98,9 +106,28 @@ public:
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
 private:
+    /// \brief A compiled clone and the types and shapes of its results
+    struct CachedExecutable
+    {
+        std::shared_ptr<Executable> m_executable;
+        std::vector<element::Type> m_result_element_types;
+        std::vector<Shape> m_result_shapes;
+    };
+    using CacheEntry = std::pair<std::string, std::shared_ptr<CachedExecutable>>;
+
+    std::shared_ptr<CachedExecutable>
+        compile_clone(const std::vector<element::Type>& arg_element_types,
+                      const std::vector<PartialShape>& arg_shapes,
+                      const std::vector<void*>& arg_value_base_pointers);
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     bool m_enable_performance_collection;
+    size_t m_cache_capacity;
+    std::mutex m_cache_mutex;
+    // Most recently used first
+    std::list<CacheEntry> m_cache;
+    std::unordered_map<std::string, std::list<CacheEntry>::iterator> m_cache_index;
 };
 
 ///
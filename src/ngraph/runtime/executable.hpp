@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "ngraph/function.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -55,6 +56,11 @@ public:
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
 
+    /// \brief Query the cost of the passes run by compile
+    /// \returns The profile of the backend's pass::Manager, empty unless pass profiling was
+    ///          enabled with NGRAPH_PROFILE_PASS_ENABLE or NGRAPH_ENABLE_TRACING
+    const pass::PassProfile& get_compile_profile() const { return m_compile_profile; }
+
     /// \brief Validates a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -113,7 +119,11 @@ protected:
     /// \param func The function with Results fully resolved.
     void set_parameters_and_results(const Function& func);
 
+    /// \brief Called after compile has run its passes
+    void set_compile_profile(const pass::PassProfile& profile) { m_compile_profile = profile; }
+
 private:
     ngraph::ParameterVector m_parameters;
     ngraph::ResultVector m_results;
+    pass::PassProfile m_compile_profile;
 };
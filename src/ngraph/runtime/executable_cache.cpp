@@ -0,0 +1,256 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <typeinfo>
+#include <vector>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/sha256.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::ExecutableCache::ExecutableCache(const shared_ptr<Backend>& backend,
+                                          size_t capacity,
+                                          const string& directory)
+    : m_backend(backend)
+    , m_capacity(capacity)
+    , m_directory(directory)
+{
+    // Executables of one build of a backend may not load in another
+    stringstream ss;
+    ss << "ngraph " << NGRAPH_VERSION << " backend " << typeid(*m_backend).name() << " "
+       << m_backend->get_version();
+    m_backend_id = ss.str();
+    if (!m_directory.empty())
+    {
+        file_util::make_directory(m_directory);
+    }
+}
+
+shared_ptr<runtime::Executable>
+    runtime::ExecutableCache::compile(const shared_ptr<Function>& func,
+                                      bool enable_performance_data)
+{
+    string digest = hash_function(func);
+    if (digest.empty())
+    {
+        m_compile_count++;
+        return m_backend->compile(func, enable_performance_data);
+    }
+    string key = m_backend_id + " function " + digest;
+    if (enable_performance_data)
+    {
+        key += " perf";
+    }
+    shared_ptr<Executable> exec = lookup(key);
+    if (exec)
+    {
+        return exec;
+    }
+
+    // Loaded executables do not collect performance data, so those are always compiled
+    if (!enable_performance_data)
+    {
+        exec = load_file(key);
+    }
+    if (!exec)
+    {
+        exec = m_backend->compile(func, enable_performance_data);
+        m_compile_count++;
+        if (!enable_performance_data)
+        {
+            save_file(key, exec);
+        }
+    }
+    insert(key, exec);
+    return exec;
+}
+
+shared_ptr<runtime::Executable>
+    runtime::ExecutableCache::compile(const shared_ptr<Function>& func,
+                                      pass::PassConfig& pass_config,
+                                      bool enable_performance_data)
+{
+    string digest = hash_function(func);
+    if (digest.empty())
+    {
+        m_compile_count++;
+        return m_backend->compile(func, pass_config, enable_performance_data);
+    }
+    stringstream ss;
+    ss << m_backend_id << " function " << digest
+       << (enable_performance_data ? " perf" : "") << " config";
+    for (auto& enable : pass_config.get_enables())
+    {
+        ss << ":" << enable.first << "=" << enable.second;
+    }
+    for (auto& attribute : pass_config.get_pass_attributes())
+    {
+        ss << ":" << attribute.first << "=" << attribute.second;
+    }
+    string key = ss.str();
+
+    shared_ptr<Executable> exec = lookup(key);
+    if (!exec)
+    {
+        exec = m_backend->compile(func, pass_config, enable_performance_data);
+        m_compile_count++;
+        insert(key, exec);
+    }
+    return exec;
+}
+
+size_t runtime::ExecutableCache::size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+void runtime::ExecutableCache::clear()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+}
+
+shared_ptr<runtime::Executable> runtime::ExecutableCache::lookup(const string& key)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+        return nullptr;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    m_hit_count++;
+    return it->second->second;
+}
+
+void runtime::ExecutableCache::insert(const string& key, const shared_ptr<Executable>& exec)
+{
+    if (m_capacity == 0 || !exec)
+    {
+        return;
+    }
+    lock_guard<mutex> lock(m_mutex);
+    // Another thread may have compiled the same function in the meantime
+    auto it = m_index.find(key);
+    if (it != m_index.end())
+    {
+        it->second->second = exec;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+    m_entries.emplace_front(key, exec);
+    m_index.insert({key, m_entries.begin()});
+    while (m_entries.size() > m_capacity)
+    {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+}
+
+shared_ptr<runtime::Executable> runtime::ExecutableCache::load_file(const string& key)
+{
+    shared_ptr<Executable> exec;
+    if (m_directory.empty())
+    {
+        return exec;
+    }
+    // Files are named by a digest of the key. The key itself is stored beside the executable
+    // and checked before the executable is used.
+    string path = get_file_path(key, ".exe");
+    ifstream key_in(get_file_path(key, ".key"), ios::binary);
+    stringstream stored_key;
+    stored_key << key_in.rdbuf();
+    if (!key_in || stored_key.str() != key)
+    {
+        return exec;
+    }
+    ifstream in(path, ios::binary);
+    if (!in)
+    {
+        return exec;
+    }
+    try
+    {
+        exec = m_backend->load(in);
+    }
+    catch (const exception& e)
+    {
+        // A stale or truncated file is not fatal, the function is compiled again
+        NGRAPH_WARN << "Failed to load cached executable " << path << ": " << e.what();
+    }
+    if (exec)
+    {
+        m_load_count++;
+    }
+    return exec;
+}
+
+void runtime::ExecutableCache::save_file(const string& key, const shared_ptr<Executable>& exec)
+{
+    if (m_directory.empty() || !exec)
+    {
+        return;
+    }
+    // Each file is written to a private file first and renamed into place, so processes
+    // sharing the directory never see a partially written one. The key goes last, so an
+    // executable is never found without its key being complete.
+    string path = get_file_path(key, ".exe");
+    vector<pair<string, function<void(ostream&)>>> files{
+        {path, [&](ostream& out) { exec->save(out); }},
+        {get_file_path(key, ".key"), [&](ostream& out) { out << key; }}};
+    for (auto& file : files)
+    {
+        string tmp_path = file.first + "." + to_string(random_device()()) + ".tmp";
+        try
+        {
+            {
+                ofstream out(tmp_path, ios::binary);
+                file.second(out);
+                if (!out)
+                {
+                    throw runtime_error("write failed");
+                }
+            }
+            if (rename(tmp_path.c_str(), file.first.c_str()) != 0)
+            {
+                throw runtime_error("rename failed");
+            }
+        }
+        catch (const exception& e)
+        {
+            NGRAPH_WARN << "Failed to save cached executable " << path << ": " << e.what();
+            remove(tmp_path.c_str());
+            return;
+        }
+    }
+}
+
+string runtime::ExecutableCache::get_file_path(const string& key, const string& extension) const
+{
+    return file_util::path_join(m_directory, sha256_hex(key) + extension);
+}
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ngraph/function.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ExecutableCache;
+    }
+}
+
+/// \brief Compiles Functions on a Backend and keeps the results, keyed by hash_function, so
+/// that compiling the same model again returns the Executable already built for it.
+///
+/// The most recently used executables are kept in memory. If a directory is given,
+/// executables are also written there with Executable::save, and a model not in memory is
+/// first looked for there and read back with Backend::load before it is compiled. The key
+/// also names the ngraph version and the type and version of the backend. It is saved along
+/// with each executable and compared before the executable is loaded, so a directory may be
+/// shared by any caches. Functions hash_function can not digest are always compiled.
+class ngraph::runtime::ExecutableCache
+{
+public:
+    /// \param backend The backend that compiles and loads the executables
+    /// \param capacity The number of executables kept in memory
+    /// \param directory Where executables are saved across processes. No files are written if
+    ///    empty.
+    ExecutableCache(const std::shared_ptr<Backend>& backend,
+                    size_t capacity = 16,
+                    const std::string& directory = "");
+
+    /// \brief Returns the cached Executable for func, compiling it on a miss
+    std::shared_ptr<Executable> compile(const std::shared_ptr<Function>& func,
+                                        bool enable_performance_data = false);
+
+    /// \brief Returns the cached Executable for func and pass_config, compiling it on a miss.
+    /// Backend::load does not take a PassConfig, so these are only cached in memory.
+    std::shared_ptr<Executable> compile(const std::shared_ptr<Function>& func,
+                                        pass::PassConfig& pass_config,
+                                        bool enable_performance_data = false);
+
+    /// \returns The number of executables held in memory
+    size_t size() const;
+    /// \brief Drops all executables held in memory. Saved files are kept.
+    void clear();
+
+    size_t get_hit_count() const { return m_hit_count; }
+    size_t get_load_count() const { return m_load_count; }
+    size_t get_compile_count() const { return m_compile_count; }
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<Executable>>;
+
+    std::shared_ptr<Executable> lookup(const std::string& key);
+    void insert(const std::string& key, const std::shared_ptr<Executable>& exec);
+    std::shared_ptr<Executable> load_file(const std::string& key);
+    void save_file(const std::string& key, const std::shared_ptr<Executable>& exec);
+    std::string get_file_path(const std::string& key, const std::string& extension) const;
+
+    std::shared_ptr<Backend> m_backend;
+    size_t m_capacity;
+    std::string m_directory;
+    std::string m_backend_id;
+    mutable std::mutex m_mutex;
+    // Most recently used first
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+    std::atomic<size_t> m_hit_count{0};
+    std::atomic<size_t> m_load_count{0};
+    std::atomic<size_t> m_compile_count{0};
+};
@@ -62,6 +62,21 @@ shared_ptr<runtime::Executable>
     return make_shared<GCPUExecutable>(function, enable_performance_collection);
 }
 
+shared_ptr<runtime::Executable>
+    runtime::gcpu::GCPUBackend::compile(shared_ptr<Function> function,
+                                        pass::PassConfig& pass_config,
+                                        bool enable_performance_collection)
+{
+    auto exec = make_shared<GCPUExecutable>(function, enable_performance_collection);
+    const map<string, bool>& attributes = pass_config.get_pass_attributes();
+    auto it = attributes.find("IntraOpParallelism");
+    if (it != attributes.end())
+    {
+        exec->set_intra_op_parallelism(it->second);
+    }
+    return exec;
+}
+
 bool runtime::gcpu::GCPUBackend::is_supported(const Node& node) const
 {
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
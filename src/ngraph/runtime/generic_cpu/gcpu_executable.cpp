@@ -31,6 +31,7 @@
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -53,12 +54,15 @@ runtime::gcpu::GCPUExecutable::GCPUExecutable(const shared_ptr<Function>& functi
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
     pass_manager.register_pass<pass::Liveness>();
     pass_manager.run_passes(m_function);
+    set_compile_profile(pass_manager.get_profile());
 
     for (const shared_ptr<Node>& node : m_function->get_ordered_ops())
     {
         m_wrapped_nodes.emplace_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_task_graph();
+    set_inter_op_concurrency(get_default_inter_op_concurrency());
 }
 
 runtime::gcpu::GCPUExecutable::GCPUExecutable(const std::string& model_string)
@@ -71,11 +75,15 @@ runtime::gcpu::GCPUExecutable::GCPUExecutable(const std::string& model_string)
         m_wrapped_nodes.emplace_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_task_graph();
+    set_inter_op_concurrency(get_default_inter_op_concurrency());
 }
 
 bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                          const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
+    ThreadPool::SerialScope serial_scope(!m_intra_op_parallelism_enabled);
+
     // convert inputs to HostTensor
     vector<shared_ptr<HostTensor>> func_inputs;
     for (auto tensor : inputs)
@@ -120,26 +128,26 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
-    // for each ordered op in the graph
-    for (const NodeWrapper& wrapped : m_wrapped_nodes)
+    // bind the arguments of every op up front so the ops can then run in any order that
+    // respects the task graph
+    vector<vector<shared_ptr<HostTensor>>> op_inputs(m_wrapped_nodes.size());
+    vector<vector<shared_ptr<HostTensor>>> op_outputs(m_wrapped_nodes.size());
+    for (size_t node_index = 0; node_index < m_wrapped_nodes.size(); ++node_index)
     {
-        auto op = wrapped.get_node();
-        auto type_id = wrapped.get_typeid();
-        if (type_id == OP_TYPEID::Parameter)
+        auto op = m_wrapped_nodes[node_index].get_node();
+        if (m_wrapped_nodes[node_index].get_typeid() == OP_TYPEID::Parameter)
         {
             continue;
         }
 
         // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
         for (auto input : op->inputs())
         {
             descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            op_inputs[node_index].push_back(tensor_map.at(tensor));
         }
 
         // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = &op->output(i).get_tensor();
@@ -157,56 +165,115 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
             {
                 host_tensor = it->second;
             }
-            op_outputs.push_back(host_tensor);
+            op_outputs[node_index].push_back(host_tensor);
         }
+    }
 
-        // get op type
-        element::Type type;
-#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wswitch-enum"
-#endif
-        switch (type_id)
+    if (m_scheduler)
+    {
+        m_scheduler->run(m_task_graph, [&](size_t node_index) {
+            ThreadPool::SerialScope task_serial_scope(!m_intra_op_parallelism_enabled);
+            execute_op(m_wrapped_nodes[node_index], op_outputs[node_index], op_inputs[node_index]);
+        });
+    }
+    else
+    {
+        for (size_t node_index = 0; node_index < m_wrapped_nodes.size(); ++node_index)
         {
-        case OP_TYPEID::Convert:
-        case OP_TYPEID::Quantize:
-        case OP_TYPEID::Dequantize:
-        case OP_TYPEID::ArgMin:
-        case OP_TYPEID::ArgMax: type = op->get_input_element_type(0); break;
-        case OP_TYPEID::Equal:
-        case OP_TYPEID::Greater:
-        case OP_TYPEID::GreaterEq:
-        case OP_TYPEID::Less:
-        case OP_TYPEID::LessEq:
-        case OP_TYPEID::NotEqual:
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
-            break;
-        case OP_TYPEID::TopK: type = op->get_output_element_type(1); break;
-        default: type = op->get_output_element_type(0); break;
+            execute_op(m_wrapped_nodes[node_index], op_outputs[node_index], op_inputs[node_index]);
         }
-#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
-#pragma GCC diagnostic pop
-#endif
+    }
 
-        if (m_performance_counters_enabled)
+    return true;
+}
+
+void runtime::gcpu::GCPUExecutable::build_task_graph()
+{
+    // Ops are numbered by their position in the topological order. Every intermediate tensor
+    // gets its own buffer, so data and control dependencies are the only constraints.
+    unordered_map<const Node*, size_t> node_index_map;
+    m_task_graph = TaskGraph(m_wrapped_nodes.size());
+    for (size_t node_index = 0; node_index < m_wrapped_nodes.size(); ++node_index)
+    {
+        shared_ptr<const Node> op = m_wrapped_nodes[node_index].get_node();
+        node_index_map.insert({op.get(), node_index});
+        for (auto input : op->inputs())
         {
-            m_timer_map[op].start();
+            m_task_graph.add_dependency(
+                node_index_map.at(input.get_source_output().get_node()), node_index);
         }
-        generate_calls(type, wrapped, op_outputs, op_inputs);
-        if (m_performance_counters_enabled)
+        for (const shared_ptr<Node>& control : op->get_control_dependencies())
         {
-            m_timer_map[op].stop();
+            auto it = node_index_map.find(control.get());
+            if (it != node_index_map.end())
+            {
+                m_task_graph.add_dependency(it->second, node_index);
+            }
         }
-        if (m_nan_check_enabled)
+        if (m_performance_counters_enabled &&
+            m_wrapped_nodes[node_index].get_typeid() != OP_TYPEID::Parameter)
         {
-            perform_nan_check(op_outputs, op.get());
+            // Created up front so that concurrently running ops never insert into the map
+            m_timer_map.insert({op, stopwatch()});
         }
     }
+}
 
-    return true;
+void runtime::gcpu::GCPUExecutable::execute_op(const NodeWrapper& wrapped,
+                                               const vector<shared_ptr<HostTensor>>& op_outputs,
+                                               const vector<shared_ptr<HostTensor>>& op_inputs)
+{
+    auto op = wrapped.get_node();
+    auto type_id = wrapped.get_typeid();
+    if (type_id == OP_TYPEID::Parameter)
+    {
+        return;
+    }
+
+    // get op type
+    element::Type type;
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+#endif
+    switch (type_id)
+    {
+    case OP_TYPEID::Convert:
+    case OP_TYPEID::Quantize:
+    case OP_TYPEID::Dequantize:
+    case OP_TYPEID::ArgMin:
+    case OP_TYPEID::ArgMax: type = op->get_input_element_type(0); break;
+    case OP_TYPEID::Equal:
+    case OP_TYPEID::Greater:
+    case OP_TYPEID::GreaterEq:
+    case OP_TYPEID::Less:
+    case OP_TYPEID::LessEq:
+    case OP_TYPEID::NotEqual:
+        // Get the type of the second input, not the first
+        // All BinaryElementwiseComparision ops have the same type for inputs
+        // Select has bool for first input and the type we are interested in for the second
+        type = op->get_input_element_type(1);
+        break;
+    case OP_TYPEID::TopK: type = op->get_output_element_type(1); break;
+    default: type = op->get_output_element_type(0); break;
+    }
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic pop
+#endif
+
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).start();
+    }
+    generate_calls(type, wrapped, op_outputs, op_inputs);
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(op_outputs, op.get());
+    }
 }
 
 void runtime::gcpu::GCPUExecutable::generate_calls(const element::Type& type,
@@ -242,6 +309,23 @@ void runtime::gcpu::GCPUExecutable::set_nan_check(bool enable)
     m_nan_check_enabled = enable;
 }
 
+void runtime::gcpu::GCPUExecutable::set_intra_op_parallelism(bool enable)
+{
+    m_intra_op_parallelism_enabled = enable;
+}
+
+void runtime::gcpu::GCPUExecutable::set_inter_op_concurrency(size_t max_concurrency)
+{
+    if (max_concurrency <= 1)
+    {
+        m_scheduler.reset();
+    }
+    else if (!m_scheduler || m_scheduler->get_num_threads() != max_concurrency)
+    {
+        m_scheduler.reset(new TaskScheduler(max_concurrency));
+    }
+}
+
 vector<runtime::PerformanceCounter> runtime::gcpu::GCPUExecutable::get_performance_data() const
 {
     vector<runtime::PerformanceCounter> rc;
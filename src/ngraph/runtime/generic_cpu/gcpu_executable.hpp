@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -158,6 +159,7 @@
 #include "ngraph/runtime/reference/tanh.hpp"
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
+#include "ngraph/runtime/task_scheduler.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 
@@ -188,6 +190,14 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Enables or disables splitting individual ops over the intra-op thread pool.
+    /// Enabled by default.
+    void set_intra_op_parallelism(bool enable);
+
+    /// \brief Sets how many independent ops may run at the same time. 1 runs the ops one
+    /// after the other in topological order. Defaults to NGRAPH_INTER_OP_THREADS, or 1.
+    void set_inter_op_concurrency(size_t max_concurrency);
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
 private:
@@ -196,13 +206,22 @@ private:
     int get_alignment() const { return 64; }
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
+    bool m_intra_op_parallelism_enabled = true;
     bool m_performance_counters_enabled = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<NodeWrapper> m_wrapped_nodes;
+    runtime::TaskGraph m_task_graph;
+    std::unique_ptr<runtime::TaskScheduler> m_scheduler;
+    std::mutex m_states_mutex;
     std::unordered_map<const Node*, std::shared_ptr<ngraph::State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
 
+    void build_task_graph();
+    void execute_op(const NodeWrapper& wrapped,
+                    const std::vector<std::shared_ptr<HostTensor>>& outputs,
+                    const std::vector<std::shared_ptr<HostTensor>>& inputs);
+
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
@@ -385,16 +404,21 @@ private:
         case OP_TYPEID::GenerateMask:
         {
             bool use_seed = static_cast<bool>(args[2]->get_data_ptr<const int32_t>()[0]);
-            if (m_states.count(&node) == 0)
+            ngraph::BernoulliRNGState* state;
             {
-                const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
-                auto seed = use_seed ? gm->get_seed() : 0;
-                m_states[&node] = std::unique_ptr<ngraph::State>(
-                    new ngraph::BernoulliRNGState(seed, gm->get_probability()));
+                // Other ops may be running concurrently with this one
+                std::lock_guard<std::mutex> lock(m_states_mutex);
+                if (m_states.count(&node) == 0)
+                {
+                    const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
+                    auto seed = use_seed ? gm->get_seed() : 0;
+                    m_states[&node] = std::unique_ptr<ngraph::State>(
+                        new ngraph::BernoulliRNGState(seed, gm->get_probability()));
+                }
+                state = static_cast<ngraph::BernoulliRNGState*>(m_states.at(&node).get());
             }
 
             bool training = static_cast<bool>(args[0]->get_data_ptr<const T>()[0]);
-            auto state = static_cast<ngraph::BernoulliRNGState*>(m_states.at(&node).get());
             size_t element_count = shape_size(node.get_output_shape(0));
             if (!use_seed)
             {
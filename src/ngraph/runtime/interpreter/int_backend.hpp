@@ -56,6 +56,11 @@ public:
 
     std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
                                         bool enable_performance_data = false) override;
+    /// \brief Compiles a Function. Setting the IntraOpParallelism pass attribute to false
+    /// runs every op of the executable on the calling thread.
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
+                                        ngraph::pass::PassConfig& pass_config,
+                                        bool enable_performance_data = false) override;
     std::shared_ptr<Executable> load(std::istream& input_stream) override;
 
     bool is_supported(const Node& node) const override;
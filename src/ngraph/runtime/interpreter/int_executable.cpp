@@ -19,6 +19,7 @@
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/op/convert.hpp"
+#include "ngraph/op/reshape.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
 #include "ngraph/pass/assign_layout.hpp"
@@ -28,10 +29,13 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_scheduling.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/chrome_trace.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/shape_util.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -39,6 +43,33 @@ using namespace ngraph;
 
 using descriptor::layout::DenseTensorLayout;
 
+namespace
+{
+    // Lets pass::MemoryLayout give a Reshape that leaves the elements in order the memory of
+    // its input, which reference::reshape then does not copy
+    class InPlaceReshape : public pass::FunctionPass
+    {
+    public:
+        bool run_on_function(shared_ptr<Function> function) override
+        {
+            for (const shared_ptr<Node>& node : function->get_ops())
+            {
+                auto reshape = as_type_ptr<op::Reshape>(node);
+                if (reshape && !reshape->get_op_annotations() &&
+                    reshape->get_input_partial_shape(0).is_static() &&
+                    is_layout_preserving_transpose(
+                        reshape->get_input_shape(0), reshape->get_input_order()))
+                {
+                    auto op_annotations = make_shared<op::util::OpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, false});
+                    reshape->set_op_annotations(op_annotations);
+                }
+            }
+            return false;
+        }
+    };
+}
+
 runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
                                                    bool enable_performance_collection)
     : m_is_compiled{true}
@@ -50,14 +81,22 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     pass_manager.register_pass<pass::FusedOpDecomposition>();
     pass_manager.register_pass<pass::Opset0Downgrade>();
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
+    pass_manager.register_pass<pass::MemoryScheduling>(get_alignment());
+    pass_manager.register_pass<InPlaceReshape>();
     pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
     pass_manager.run_passes(m_function);
+    set_compile_profile(pass_manager.get_profile());
 
     for (const shared_ptr<Node>& node : m_function->get_ordered_ops())
     {
         m_wrapped_nodes.emplace_back(node);
     }
     set_parameters_and_results(*m_function);
+    allocate_memory_pool();
+    build_dispatch_table();
+    build_task_graph();
+    set_inter_op_concurrency(get_default_inter_op_concurrency());
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
@@ -65,51 +104,52 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     , m_performance_counters_enabled{false}
 {
     m_function = deserialize(model_string);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MemoryScheduling>(get_alignment());
+    pass_manager.register_pass<InPlaceReshape>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+    pass_manager.run_passes(m_function);
+    set_compile_profile(pass_manager.get_profile());
+
     for (const shared_ptr<Node>& node : m_function->get_ordered_ops())
     {
         m_wrapped_nodes.emplace_back(node);
     }
     set_parameters_and_results(*m_function);
+    allocate_memory_pool();
+    build_dispatch_table();
+    build_task_graph();
+    set_inter_op_concurrency(get_default_inter_op_concurrency());
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+void runtime::interpreter::INTExecutable::allocate_memory_pool()
 {
-    runtime::event::Duration d1("call", "Interpreter");
+    // All intermediate tensors live in a single arena laid out by pass::MemoryLayout. The
+    // HostTensors wrapping them are created once here, so a call only has to patch in the
+    // caller's input and output tensors.
+    m_memory_pool = AlignedBuffer(m_function->get_temporary_pool_size(), get_alignment());
 
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
-    }
-    if (m_nan_check_enabled)
-    {
-        perform_nan_check(func_inputs);
-    }
-
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
+    unordered_set<descriptor::Tensor*> pool_tensors;
+    for (const NodeWrapper& wrapped : m_wrapped_nodes)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
+        for (descriptor::Tensor* tensor : wrapped.get_node()->liveness_new_list)
+        {
+            pool_tensors.insert(tensor);
+        }
     }
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
+    unordered_map<descriptor::Tensor*, size_t> input_index;
     size_t input_count = 0;
     for (auto param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            input_index.insert({&param->output(i).get_tensor(), input_count++});
         }
     }
 
-    // map function outputs -> HostTensor
+    unordered_map<descriptor::Tensor*, size_t> output_index;
     for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
     {
         auto output = get_results()[output_count];
@@ -117,51 +157,182 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::Tensor* tensor = &output->output(0).get_tensor();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        output_index.insert({&output->output(0).get_tensor(), output_count});
     }
 
-    // for each ordered op in the graph
-    for (const NodeWrapper& wrapped : m_wrapped_nodes)
+    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
+    for (size_t node_index = 0; node_index < m_wrapped_nodes.size(); ++node_index)
     {
-        auto op = wrapped.get_node();
-        runtime::event::Duration d2(op->description(), "Interpreter");
-        auto type_id = wrapped.get_typeid();
-        if (type_id == OP_TYPEID::Parameter)
-        {
-            continue;
-        }
+        auto op = m_wrapped_nodes[node_index].get_node();
 
-        // get op inputs from map
         vector<shared_ptr<HostTensor>> op_inputs;
         for (auto input : op->inputs())
         {
             descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            auto it = input_index.find(tensor);
+            if (it != input_index.end())
+            {
+                m_input_bindings.push_back({node_index, op_inputs.size(), it->second});
+                op_inputs.push_back(nullptr);
+            }
+            else
+            {
+                op_inputs.push_back(tensor_map.at(tensor));
+            }
         }
 
-        // get op outputs from map or create
         vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = &op->output(i).get_tensor();
+            if (is_type<op::Parameter>(op))
+            {
+                op_outputs.push_back(nullptr);
+                continue;
+            }
+            auto it = output_index.find(tensor);
+            if (it != output_index.end())
+            {
+                m_output_bindings.push_back({node_index, op_outputs.size(), it->second});
+                op_outputs.push_back(nullptr);
+                continue;
+            }
+
+            const Shape& shape = op->get_output_shape(i);
+            const element::Type& type = op->get_output_element_type(i);
+            const string& name = tensor->get_name();
             shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            if (pool_tensors.count(tensor) != 0)
             {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
+                host_tensor = make_shared<runtime::HostTensor>(
+                    type, shape, m_memory_pool.get_ptr(tensor->get_pool_offset()), name);
+            }
+            else if (auto constant = as_type_ptr<const op::Constant>(op))
+            {
+                // Constants are bound directly to their payload and never executed
+                host_tensor = make_shared<runtime::HostTensor>(
+                    type, shape, const_cast<void*>(constant->get_data_ptr()), name);
             }
             else
             {
-                host_tensor = it->second;
+                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
             }
+            tensor_map.insert({tensor, host_tensor});
             op_outputs.push_back(host_tensor);
         }
 
+        m_op_inputs.push_back(move(op_inputs));
+        m_op_outputs.push_back(move(op_outputs));
+    }
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    runtime::event::Duration d1("call", "Interpreter");
+    lock_guard<mutex> lock(m_call_mutex);
+    ThreadPool::SerialScope serial_scope(!m_intra_op_parallelism_enabled);
+
+    if (m_nan_check_enabled)
+    {
+        vector<shared_ptr<HostTensor>> func_inputs;
+        for (auto tensor : inputs)
+        {
+            func_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tensor));
+        }
+        perform_nan_check(func_inputs);
+    }
+
+    // The caller's tensors are released when the call returns or throws, so the executable
+    // does not keep them alive between calls
+    struct TensorUnbinder
+    {
+        ~TensorUnbinder()
+        {
+            for (const TensorBinding& binding : m_executable->m_input_bindings)
+            {
+                m_executable->m_op_inputs[binding.m_node_index][binding.m_arg_index] = nullptr;
+            }
+            for (const TensorBinding& binding : m_executable->m_output_bindings)
+            {
+                m_executable->m_op_outputs[binding.m_node_index][binding.m_arg_index] = nullptr;
+            }
+        }
+        INTExecutable* m_executable;
+    } unbinder{this};
+
+    // bind function params and outputs to the preallocated op argument lists
+    for (const TensorBinding& binding : m_input_bindings)
+    {
+        m_op_inputs[binding.m_node_index][binding.m_arg_index] =
+            static_pointer_cast<runtime::HostTensor>(inputs[binding.m_tensor_index]);
+    }
+    for (const TensorBinding& binding : m_output_bindings)
+    {
+        m_op_outputs[binding.m_node_index][binding.m_arg_index] =
+            static_pointer_cast<runtime::HostTensor>(outputs[binding.m_tensor_index]);
+    }
+
+    if (m_scheduler)
+    {
+        m_scheduler->run(m_task_graph, [this](size_t task) {
+            ThreadPool::SerialScope task_serial_scope(!m_intra_op_parallelism_enabled);
+            execute_op(m_dispatch_table[task]);
+        });
+    }
+    else
+    {
+        for (const OpDispatch& dispatch : m_dispatch_table)
+        {
+            execute_op(dispatch);
+        }
+    }
+
+    return true;
+}
+
+void runtime::interpreter::INTExecutable::execute_op(const OpDispatch& dispatch)
+{
+    const NodeWrapper& wrapped = m_wrapped_nodes[dispatch.m_node_index];
+    const shared_ptr<const Node>& op = wrapped.get_node();
+    runtime::event::Duration d2(op->description(), "Interpreter");
+    if (!dispatch.m_kernel)
+    {
+        stringstream ss;
+        ss << "unsupported element type " << dispatch.m_type << " op " << op->get_name();
+        throw ngraph_error(ss.str());
+    }
+
+    const vector<shared_ptr<HostTensor>>& op_inputs = m_op_inputs[dispatch.m_node_index];
+    const vector<shared_ptr<HostTensor>>& op_outputs = m_op_outputs[dispatch.m_node_index];
+
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).start();
+    }
+    dispatch.m_kernel(op_outputs, op_inputs);
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(op_outputs, op.get());
+    }
+}
+
+void runtime::interpreter::INTExecutable::build_dispatch_table()
+{
+    for (size_t node_index = 0; node_index < m_wrapped_nodes.size(); ++node_index)
+    {
+        const NodeWrapper& wrapped = m_wrapped_nodes[node_index];
+        const shared_ptr<const Node>& op = wrapped.get_node();
+        auto type_id = wrapped.get_typeid();
+        if (type_id == OP_TYPEID::Parameter || type_id == OP_TYPEID::Constant)
+        {
+            continue;
+        }
+
         // get op type
         element::Type type;
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
@@ -193,50 +364,111 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
 #pragma GCC diagnostic pop
 #endif
 
+        // Unsupported element types are reported when the op is executed
+        m_dispatch_table.push_back({node_index, type, bind_kernel(wrapped, type)});
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].start();
+            // Created up front so that concurrently running ops never insert into the map
+            m_timer_map.insert({op, stopwatch()});
         }
-        generate_calls(type, wrapped, op_outputs, op_inputs);
-        if (m_performance_counters_enabled)
+    }
+}
+
+void runtime::interpreter::INTExecutable::build_task_graph()
+{
+    // Besides its data and control dependencies, an op that writes to the memory pool has to
+    // wait for every earlier op that reads or writes an overlapping range. pass::MemoryLayout
+    // hands the space of dead tensors to later ones, so without these edges an op running
+    // early could overwrite a tensor that is still being read.
+    struct PoolAccess
+    {
+        size_t m_task;
+        size_t m_begin;
+        size_t m_end;
+    };
+    vector<PoolAccess> accesses;
+    unordered_set<const descriptor::Tensor*> pool_tensors;
+    unordered_map<const Node*, size_t> task_index;
+
+    m_task_graph = TaskGraph(m_dispatch_table.size());
+    for (size_t task = 0; task < m_dispatch_table.size(); ++task)
+    {
+        const Node* op = m_wrapped_nodes[m_dispatch_table[task].m_node_index].get_node().get();
+        task_index.insert({op, task});
+
+        vector<PoolAccess> reads;
+        for (auto input : op->inputs())
         {
-            m_timer_map[op].stop();
+            auto it = task_index.find(input.get_source_output().get_node());
+            if (it != task_index.end())
+            {
+                m_task_graph.add_dependency(it->second, task);
+            }
+            const descriptor::Tensor& tensor = input.get_tensor();
+            if (pool_tensors.count(&tensor) != 0)
+            {
+                size_t offset = tensor.get_pool_offset();
+                reads.push_back({task, offset, offset + tensor.size()});
+            }
         }
-        if (m_nan_check_enabled)
+        for (const shared_ptr<Node>& control : op->get_control_dependencies())
         {
-            perform_nan_check(op_outputs, op.get());
+            auto it = task_index.find(control.get());
+            if (it != task_index.end())
+            {
+                m_task_graph.add_dependency(it->second, task);
+            }
         }
-    }
 
-    return true;
+        for (descriptor::Tensor* tensor : op->liveness_new_list)
+        {
+            pool_tensors.insert(tensor);
+            PoolAccess write{task, tensor->get_pool_offset(), tensor->get_pool_offset()};
+            write.m_end += tensor->size();
+            size_t kept = 0;
+            for (const PoolAccess& access : accesses)
+            {
+                if (access.m_begin < write.m_end && write.m_begin < access.m_end)
+                {
+                    m_task_graph.add_dependency(access.m_task, task);
+                }
+                // A range covered by this write is ordered before every later op that touches
+                // it through the edges added for this write, so it need not be kept
+                if (access.m_begin < write.m_begin || access.m_end > write.m_end)
+                {
+                    accesses[kept++] = access;
+                }
+            }
+            accesses.resize(kept);
+            accesses.push_back(write);
+        }
+        accesses.insert(accesses.end(), reads.begin(), reads.end());
+    }
 }
 
-void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
-                                                         const NodeWrapper& op,
-                                                         const vector<shared_ptr<HostTensor>>& out,
-                                                         const vector<shared_ptr<HostTensor>>& in)
+runtime::interpreter::INTExecutable::OpKernel
+    runtime::interpreter::INTExecutable::bind_kernel(const NodeWrapper& node_wrapper,
+                                                     const element::Type& type)
 {
-    stringstream ss;
     switch (type)
     {
-    case element::Type_t::boolean: op_engine<char>(op, out, in); break;
-    case element::Type_t::f32: op_engine<float>(op, out, in); break;
-    case element::Type_t::f64: op_engine<double>(op, out, in); break;
-    case element::Type_t::i8: op_engine<int8_t>(op, out, in); break;
-    case element::Type_t::i16: op_engine<int16_t>(op, out, in); break;
-    case element::Type_t::i32: op_engine<int32_t>(op, out, in); break;
-    case element::Type_t::i64: op_engine<int64_t>(op, out, in); break;
-    case element::Type_t::u8: op_engine<uint8_t>(op, out, in); break;
-    case element::Type_t::u16: op_engine<uint16_t>(op, out, in); break;
-    case element::Type_t::u32: op_engine<uint32_t>(op, out, in); break;
-    case element::Type_t::u64: op_engine<uint64_t>(op, out, in); break;
+    case element::Type_t::boolean: return bind_op<char>(node_wrapper);
+    case element::Type_t::f32: return bind_op<float>(node_wrapper);
+    case element::Type_t::f64: return bind_op<double>(node_wrapper);
+    case element::Type_t::i8: return bind_op<int8_t>(node_wrapper);
+    case element::Type_t::i16: return bind_op<int16_t>(node_wrapper);
+    case element::Type_t::i32: return bind_op<int32_t>(node_wrapper);
+    case element::Type_t::i64: return bind_op<int64_t>(node_wrapper);
+    case element::Type_t::u8: return bind_op<uint8_t>(node_wrapper);
+    case element::Type_t::u16: return bind_op<uint16_t>(node_wrapper);
+    case element::Type_t::u32: return bind_op<uint32_t>(node_wrapper);
+    case element::Type_t::u64: return bind_op<uint64_t>(node_wrapper);
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
     case element::Type_t::bf16:
-    case element::Type_t::f16:
-        ss << "unsupported element type " << type << " op " << op.get_node()->get_name();
-        throw ngraph_error(ss.str());
+    case element::Type_t::f16: break;
     }
+    return nullptr;
 }
 
 void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
@@ -244,6 +476,24 @@ void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
     m_nan_check_enabled = enable;
 }
 
+void runtime::interpreter::INTExecutable::set_intra_op_parallelism(bool enable)
+{
+    m_intra_op_parallelism_enabled = enable;
+}
+
+void runtime::interpreter::INTExecutable::set_inter_op_concurrency(size_t max_concurrency)
+{
+    lock_guard<mutex> lock(m_call_mutex);
+    if (max_concurrency <= 1)
+    {
+        m_scheduler.reset();
+    }
+    else if (!m_scheduler || m_scheduler->get_num_threads() != max_concurrency)
+    {
+        m_scheduler.reset(new TaskScheduler(max_concurrency));
+    }
+}
+
 vector<runtime::PerformanceCounter>
     runtime::interpreter::INTExecutable::get_performance_data() const
 {
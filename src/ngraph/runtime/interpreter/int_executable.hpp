@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -175,6 +177,7 @@
 #include "ngraph/runtime/reference/tanh.hpp"
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
+#include "ngraph/runtime/task_scheduler.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
@@ -206,6 +209,14 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Enables or disables splitting individual ops over the intra-op thread pool.
+    /// Enabled by default.
+    void set_intra_op_parallelism(bool enable);
+
+    /// \brief Sets how many independent ops may run at the same time. 1 runs the ops one
+    /// after the other in topological order. Defaults to NGRAPH_INTER_OP_THREADS, or 1.
+    void set_inter_op_concurrency(size_t max_concurrency);
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
@@ -221,30 +232,75 @@ public:
 private:
     INTExecutable(const std::string& model_string);
 
+    /// \brief Identifies the position of a function input or output tensor in the
+    /// preallocated op argument lists. These positions are set at the start of every call
+    /// and cleared at its end.
+    struct TensorBinding
+    {
+        size_t m_node_index;
+        size_t m_arg_index;
+        size_t m_tensor_index;
+    };
+
+    using HostTensorVector = std::vector<std::shared_ptr<HostTensor>>;
+    using OpKernel =
+        std::function<void(const HostTensorVector& out, const HostTensorVector& args)>;
+
+    /// \brief A node lowered at compile time. The op and element type dispatch is resolved
+    /// once by bind_op, so a call is a flat loop of kernel calls.
+    struct OpDispatch
+    {
+        size_t m_node_index;
+        element::Type m_type;
+        OpKernel m_kernel;
+    };
+
     std::shared_ptr<ngraph::op::Parameter> get_parameter(size_t index) const;
     std::shared_ptr<ngraph::op::Result> get_result(size_t index) const;
     int get_alignment() const { return 64; }
+    void allocate_memory_pool();
+    void execute_op(const OpDispatch& dispatch);
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
+    bool m_intra_op_parallelism_enabled = true;
     bool m_performance_counters_enabled = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<NodeWrapper> m_wrapped_nodes;
+    std::vector<OpDispatch> m_dispatch_table;
+    runtime::AlignedBuffer m_memory_pool;
+    std::vector<std::vector<std::shared_ptr<HostTensor>>> m_op_inputs;
+    std::vector<std::vector<std::shared_ptr<HostTensor>>> m_op_outputs;
+    std::vector<TensorBinding> m_input_bindings;
+    std::vector<TensorBinding> m_output_bindings;
+    runtime::TaskGraph m_task_graph;
+    std::unique_ptr<runtime::TaskScheduler> m_scheduler;
+    std::mutex m_call_mutex;
+    std::mutex m_states_mutex;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        const NodeWrapper& op,
-                        const std::vector<std::shared_ptr<HostTensor>>& outputs,
-                        const std::vector<std::shared_ptr<HostTensor>>& inputs);
+    OpKernel bind_kernel(const NodeWrapper& node_wrapper, const element::Type& type);
+    void build_dispatch_table();
+    void build_task_graph();
+
+    static void skip_op(const HostTensorVector& /* out */, const HostTensorVector& /* args */) {}
+    /// \returns A kernel that throws unsupported_op with message when it is run
+    static OpKernel unsupported_op_kernel(const std::string& message)
+    {
+        return [message](const HostTensorVector& /* out */, const HostTensorVector& /* args */) {
+            throw unsupported_op(message);
+        };
+    }
 
+    /// \brief Binds the node to the reference kernel for element type T. Everything the kernel
+    /// needs from the node, such as its shapes and attributes, is read here once and captured
+    /// by the returned closure, which then only reads and writes the tensors of a call.
     template <typename T>
-    void op_engine(const NodeWrapper& node_wrapper,
-                   const std::vector<std::shared_ptr<HostTensor>>& out,
-                   const std::vector<std::shared_ptr<HostTensor>>& args)
+    OpKernel bind_op(const NodeWrapper& node_wrapper)
     {
         const Node& node = *node_wrapper.get_node();
 
@@ -272,269 +328,337 @@ private:
         case OP_TYPEID::Abs:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::abs<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::abs<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Acos:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::acos<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::acos<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Add:
         {
             const op::Add* add = static_cast<const op::Add*>(&node);
-            reference::add<T>(args[0]->get_data_ptr<const T>(),
-                              args[1]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_input_shape(1),
-                              add->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = add->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::add<T>(args[0]->get_data_ptr<const T>(),
+                                  args[1]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  arg0_shape,
+                                  arg1_shape,
+                                  autob);
+            };
         }
         case OP_TYPEID::All:
         {
             const op::All* all = static_cast<const op::All*>(&node);
-            reference::all(args[0]->get_data_ptr<const char>(),
-                           out[0]->get_data_ptr<char>(),
-                           node.get_input_shape(0),
-                           node.get_output_shape(0),
-                           all->get_reduction_axes());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axes = all->get_reduction_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::all(args[0]->get_data_ptr<const char>(),
+                               out[0]->get_data_ptr<char>(),
+                               arg0_shape,
+                               out0_shape,
+                               reduction_axes);
+            };
         }
         case OP_TYPEID::AllReduce:
         {
             const ngraph::op::AllReduce* allreduce =
                 static_cast<const ngraph::op::AllReduce*>(&node);
-            reference::allreduce<T>(args[0]->get_data_ptr<T>(),
-                                    out[0]->get_data_ptr<T>(),
-                                    node.get_input_element_type(0),
-                                    allreduce->get_reduce_type(),
-                                    static_cast<int>(shape_size(node.get_input_shape(0))));
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            element::Type arg0_type = node.get_input_element_type(0);
+            auto reduce_type = allreduce->get_reduce_type();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::allreduce<T>(args[0]->get_data_ptr<T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        arg0_type,
+                                        reduce_type,
+                                        static_cast<int>(shape_size(arg0_shape)));
+            };
         }
         case OP_TYPEID::And:
         {
             auto logical_and = static_cast<const op::And*>(&node);
-            reference::logical_and(args[0]->get_data_ptr<const T>(),
-                                   args[1]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_input_shape(1),
-                                   logical_and->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = logical_and->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::logical_and(args[0]->get_data_ptr<const T>(),
+                                       args[1]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg0_shape,
+                                       arg1_shape,
+                                       autob);
+            };
         }
         case OP_TYPEID::Any:
         {
             const op::Any* any = static_cast<const op::Any*>(&node);
-            reference::any(args[0]->get_data_ptr<const char>(),
-                           out[0]->get_data_ptr<char>(),
-                           node.get_input_shape(0),
-                           node.get_output_shape(0),
-                           any->get_reduction_axes());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axes = any->get_reduction_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::any(args[0]->get_data_ptr<const char>(),
+                               out[0]->get_data_ptr<char>(),
+                               arg0_shape,
+                               out0_shape,
+                               reduction_axes);
+            };
         }
         case OP_TYPEID::ArgMin:
         {
             const op::ArgMin* argmin = static_cast<const op::ArgMin*>(&node);
             auto element_type = node.get_output_element_type(0);
-            if (element_type == element::i64)
-            {
-                reference::argmin<T, int64_t>(args[0]->get_data_ptr<const T>(),
-                                              out[0]->get_data_ptr<int64_t>(),
-                                              node.get_input_shape(0),
-                                              node.get_output_shape(0),
-                                              argmin->get_reduction_axis());
-            }
-            else if (element_type == element::i32)
-            {
-                reference::argmin<T, int32_t>(args[0]->get_data_ptr<const T>(),
-                                              out[0]->get_data_ptr<int32_t>(),
-                                              node.get_input_shape(0),
-                                              node.get_output_shape(0),
-                                              argmin->get_reduction_axis());
-            }
-            else
-            {
-                throw ngraph_error("Unexpected type");
-            }
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axis = argmin->get_reduction_axis();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (element_type == element::i64)
+                {
+                    reference::argmin<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                                  out[0]->get_data_ptr<int64_t>(),
+                                                  arg0_shape,
+                                                  out0_shape,
+                                                  reduction_axis);
+                }
+                else if (element_type == element::i32)
+                {
+                    reference::argmin<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                                  out[0]->get_data_ptr<int32_t>(),
+                                                  arg0_shape,
+                                                  out0_shape,
+                                                  reduction_axis);
+                }
+                else
+                {
+                    throw ngraph_error("Unexpected type");
+                }
+            };
         }
         case OP_TYPEID::ArgMax:
         {
             const op::ArgMax* argmax = static_cast<const op::ArgMax*>(&node);
             auto element_type = node.get_output_element_type(0);
-            if (element_type == element::i64)
-            {
-                reference::argmax<T, int64_t>(args[0]->get_data_ptr<const T>(),
-                                              out[0]->get_data_ptr<int64_t>(),
-                                              node.get_input_shape(0),
-                                              node.get_output_shape(0),
-                                              argmax->get_reduction_axis());
-            }
-            else if (element_type == element::i32)
-            {
-                reference::argmax<T, int32_t>(args[0]->get_data_ptr<const T>(),
-                                              out[0]->get_data_ptr<int32_t>(),
-                                              node.get_input_shape(0),
-                                              node.get_output_shape(0),
-                                              argmax->get_reduction_axis());
-            }
-            else
-            {
-                throw ngraph_error("Unexpected type");
-            }
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axis = argmax->get_reduction_axis();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (element_type == element::i64)
+                {
+                    reference::argmax<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                                  out[0]->get_data_ptr<int64_t>(),
+                                                  arg0_shape,
+                                                  out0_shape,
+                                                  reduction_axis);
+                }
+                else if (element_type == element::i32)
+                {
+                    reference::argmax<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                                  out[0]->get_data_ptr<int32_t>(),
+                                                  arg0_shape,
+                                                  out0_shape,
+                                                  reduction_axis);
+                }
+                else
+                {
+                    throw ngraph_error("Unexpected type");
+                }
+            };
         }
         case OP_TYPEID::Asin:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::asin<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::asin<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Atan:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::atan<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::atan<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Atan2:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::atan2<T>(args[0]->get_data_ptr<const T>(),
-                                args[1]->get_data_ptr<const T>(),
-                                out[0]->get_data_ptr<T>(),
-                                element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::atan2<T>(args[0]->get_data_ptr<const T>(),
+                                    args[1]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    element_count);
+            };
         }
         case OP_TYPEID::AvgPool:
         {
             const op::AvgPool* avg_pool = static_cast<const op::AvgPool*>(&node);
-
-            reference::avg_pool<T>(args[0]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   avg_pool->get_window_shape(),
-                                   avg_pool->get_window_movement_strides(),
-                                   avg_pool->get_padding_below(),
-                                   avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto include_padding = avg_pool->get_include_padding_in_avg_computation();
+            auto padding_above = avg_pool->get_padding_above();
+            auto padding_below = avg_pool->get_padding_below();
+            auto window_movement_strides = avg_pool->get_window_movement_strides();
+            auto window_shape = avg_pool->get_window_shape();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::avg_pool<T>(args[0]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg0_shape,
+                                       out0_shape,
+                                       window_shape,
+                                       window_movement_strides,
+                                       padding_below,
+                                       padding_above,
+                                       include_padding);
+            };
         }
         case OP_TYPEID::BinaryConvolution:
         {
-            throw unsupported_op("Unsupported op '" + node.description() + "'");
-            break;
+            return unsupported_op_kernel("Unsupported op '" + node.description() + "'");
         }
         case OP_TYPEID::GenerateMask:
         {
-            bool use_seed = static_cast<bool>(args[2]->get_data_ptr<const int32_t>()[0]);
-            if (m_states.count(&node) == 0)
-            {
-                const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
-                auto seed = use_seed ? gm->get_seed() : 0;
-                m_states[&node] =
-                    std::unique_ptr<State>(new BernoulliRNGState(seed, gm->get_probability()));
-            }
+            Shape out0_shape = node.get_output_shape(0);
+            return [=, &node](const HostTensorVector& out, const HostTensorVector& args) {
+                bool use_seed = static_cast<bool>(args[2]->get_data_ptr<const int32_t>()[0]);
+                BernoulliRNGState* state;
+                {
+                    // Other ops may be running concurrently with this one
+                    std::lock_guard<std::mutex> lock(m_states_mutex);
+                    if (m_states.count(&node) == 0)
+                    {
+                        const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
+                        auto seed = use_seed ? gm->get_seed() : 0;
+                        m_states[&node] = std::unique_ptr<State>(
+                            new BernoulliRNGState(seed, gm->get_probability()));
+                    }
+                    state = static_cast<BernoulliRNGState*>(m_states.at(&node).get());
+                }
 
-            bool training = static_cast<bool>(args[0]->get_data_ptr<const T>()[0]);
-            auto state = static_cast<BernoulliRNGState*>(m_states.at(&node).get());
-            size_t element_count = shape_size(node.get_output_shape(0));
-            if (!use_seed)
-            {
-                reference::generate_mask<T>(
-                    out[0]->get_data_ptr<T>(), element_count, state, training);
-            }
-            else
-            {
-                uint64_t seed = static_cast<uint64_t>(args[3]->get_data_ptr<const T>()[0]);
-                double prob = static_cast<double>(args[4]->get_data_ptr<const T>()[0]);
-                reference::generate_mask_no_state<T>(
-                    out[0]->get_data_ptr<T>(), element_count, training, seed, prob);
-            }
-            break;
+                bool training = static_cast<bool>(args[0]->get_data_ptr<const T>()[0]);
+                size_t element_count = shape_size(out0_shape);
+                if (!use_seed)
+                {
+                    reference::generate_mask<T>(
+                        out[0]->get_data_ptr<T>(), element_count, state, training);
+                }
+                else
+                {
+                    uint64_t seed = static_cast<uint64_t>(args[3]->get_data_ptr<const T>()[0]);
+                    double prob = static_cast<double>(args[4]->get_data_ptr<const T>()[0]);
+                    reference::generate_mask_no_state<T>(
+                        out[0]->get_data_ptr<T>(), element_count, training, seed, prob);
+                }
+            };
         }
         case OP_TYPEID::GetOutputElement:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
             size_t num_bytes = element_count * node.get_output_element_type(0).size();
-            std::memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), num_bytes);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                std::memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), num_bytes);
+            };
         }
         case OP_TYPEID::BatchMatMul:
         {
-            reference::batch_mat_mul(args[0]->get_data_ptr<const T>(),
-                                     args[1]->get_data_ptr<const T>(),
-                                     out[0]->get_data_ptr<T>(),
-                                     node.get_input_shape(0),
-                                     node.get_input_shape(1),
-                                     node.get_output_shape(0));
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::batch_mat_mul(args[0]->get_data_ptr<const T>(),
+                                         args[1]->get_data_ptr<const T>(),
+                                         out[0]->get_data_ptr<T>(),
+                                         arg0_shape,
+                                         arg1_shape,
+                                         out0_shape);
+            };
         }
 
         case OP_TYPEID::BatchNormTraining:
         {
             const ngraph::op::BatchNormTraining* bn =
                 static_cast<const ngraph::op::BatchNormTraining*>(&node);
-            reference::batch_norm_training<T>(bn->get_eps_value(),
-                                              args[0]->get_data_ptr<const T>(),
-                                              args[1]->get_data_ptr<const T>(),
-                                              args[2]->get_data_ptr<const T>(),
-                                              out[0]->get_data_ptr<T>(),
-                                              out[1]->get_data_ptr<T>(),
-                                              out[2]->get_data_ptr<T>(),
-                                              node.get_input_shape(2));
-            break;
+            Shape arg2_shape = node.get_input_shape(2);
+            auto eps_value = bn->get_eps_value();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::batch_norm_training<T>(eps_value,
+                                                  args[0]->get_data_ptr<const T>(),
+                                                  args[1]->get_data_ptr<const T>(),
+                                                  args[2]->get_data_ptr<const T>(),
+                                                  out[0]->get_data_ptr<T>(),
+                                                  out[1]->get_data_ptr<T>(),
+                                                  out[2]->get_data_ptr<T>(),
+                                                  arg2_shape);
+            };
         }
         case OP_TYPEID::BatchNormInference:
         {
             const ngraph::op::BatchNormInference* bn =
                 static_cast<const ngraph::op::BatchNormInference*>(&node);
-            reference::batch_norm_inference<T>(bn->get_eps_value(),
+            Shape arg2_shape = node.get_input_shape(2);
+            auto eps_value = bn->get_eps_value();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::batch_norm_inference<T>(eps_value,
+                                                   args[0]->get_data_ptr<const T>(),
+                                                   args[1]->get_data_ptr<const T>(),
+                                                   args[2]->get_data_ptr<const T>(),
+                                                   args[3]->get_data_ptr<const T>(),
+                                                   args[4]->get_data_ptr<const T>(),
+                                                   out[0]->get_data_ptr<T>(),
+                                                   arg2_shape);
+            };
+        }
+        case OP_TYPEID::BatchNormTrainingBackprop:
+        {
+            const ngraph::op::BatchNormTrainingBackprop* bn_bprop =
+                static_cast<const ngraph::op::BatchNormTrainingBackprop*>(&node);
+            Shape arg2_shape = node.get_input_shape(2);
+            auto eps_value = bn_bprop->get_eps_value();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::batch_norm_backprop(eps_value,
                                                args[0]->get_data_ptr<const T>(),
                                                args[1]->get_data_ptr<const T>(),
                                                args[2]->get_data_ptr<const T>(),
                                                args[3]->get_data_ptr<const T>(),
                                                args[4]->get_data_ptr<const T>(),
+                                               args[5]->get_data_ptr<const T>(),
                                                out[0]->get_data_ptr<T>(),
-                                               node.get_input_shape(2));
-            break;
-        }
-        case OP_TYPEID::BatchNormTrainingBackprop:
-        {
-            const ngraph::op::BatchNormTrainingBackprop* bn_bprop =
-                static_cast<const ngraph::op::BatchNormTrainingBackprop*>(&node);
-            reference::batch_norm_backprop(bn_bprop->get_eps_value(),
-                                           args[0]->get_data_ptr<const T>(),
-                                           args[1]->get_data_ptr<const T>(),
-                                           args[2]->get_data_ptr<const T>(),
-                                           args[3]->get_data_ptr<const T>(),
-                                           args[4]->get_data_ptr<const T>(),
-                                           args[5]->get_data_ptr<const T>(),
-                                           out[0]->get_data_ptr<T>(),
-                                           out[1]->get_data_ptr<T>(),
-                                           out[2]->get_data_ptr<T>(),
-                                           node.get_input_shape(2));
-            break;
+                                               out[1]->get_data_ptr<T>(),
+                                               out[2]->get_data_ptr<T>(),
+                                               arg2_shape);
+            };
         }
         case OP_TYPEID::AvgPoolBackprop:
         {
             const op::AvgPoolBackprop* apb = static_cast<const op::AvgPoolBackprop*>(&node);
-            reference::avg_pool_backprop<T>(args[0]->get_data_ptr<const T>(),
-                                            out[0]->get_data_ptr<T>(),
-                                            node.get_input_shape(0),
-                                            node.get_output_shape(0),
-                                            apb->get_window_shape(),
-                                            apb->get_window_movement_strides(),
-                                            apb->get_padding_below(),
-                                            apb->get_padding_above(),
-                                            apb->get_include_padding_in_avg_computation());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto include_padding = apb->get_include_padding_in_avg_computation();
+            auto padding_above = apb->get_padding_above();
+            auto padding_below = apb->get_padding_below();
+            auto window_movement_strides = apb->get_window_movement_strides();
+            auto window_shape = apb->get_window_shape();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::avg_pool_backprop<T>(args[0]->get_data_ptr<const T>(),
+                                                out[0]->get_data_ptr<T>(),
+                                                arg0_shape,
+                                                out0_shape,
+                                                window_shape,
+                                                window_movement_strides,
+                                                padding_below,
+                                                padding_above,
+                                                include_padding);
+            };
         }
         case OP_TYPEID::Broadcast:
         {
@@ -542,348 +666,396 @@ private:
             Shape in_shape = node.get_input_shape(0);
             Shape out_shape = node.get_output_shape(0);
             AxisSet broadcast_axes = broadcast->get_broadcast_axes();
-            reference::broadcast<T>(args[0]->get_data_ptr<const T>(),
-                                    out[0]->get_data_ptr<T>(),
-                                    in_shape,
-                                    out_shape,
-                                    broadcast_axes);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::broadcast<T>(args[0]->get_data_ptr<const T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        in_shape,
+                                        out_shape,
+                                        broadcast_axes);
+            };
         }
         case OP_TYPEID::BroadcastDistributed:
         {
             const ngraph::op::BroadcastDistributed* broadcast =
                 static_cast<const ngraph::op::BroadcastDistributed*>(&node);
-            int rank_ID;
-            rank_ID = get_distributed_interface()->get_rank();
-            int root_id = broadcast->get_root_id();
-            if (rank_ID == root_id)
-            {
-                reference::broadcastdistributed<T>(
-                    args[0]->get_data_ptr<T>(),
-                    node.get_input_element_type(0),
-                    static_cast<int>(shape_size(node.get_input_shape(0))),
-                    root_id);
-                auto memSize = static_cast<int>(shape_size(node.get_input_shape(0))) * sizeof(T);
-                memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), memSize);
-            }
-            else
-            {
-                reference::broadcastdistributed<T>(
-                    out[0]->get_data_ptr<T>(),
-                    node.get_input_element_type(0),
-                    static_cast<int>(shape_size(node.get_input_shape(0))),
-                    root_id);
-            }
-            break;
-        }
-        case OP_TYPEID::BroadcastLike: break;
+            Shape arg0_shape = node.get_input_shape(0);
+            element::Type arg0_type = node.get_input_element_type(0);
+            auto broadcast_root_id = broadcast->get_root_id();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                int rank_ID;
+                rank_ID = get_distributed_interface()->get_rank();
+                int root_id = broadcast_root_id;
+                if (rank_ID == root_id)
+                {
+                    reference::broadcastdistributed<T>(
+                        args[0]->get_data_ptr<T>(),
+                        arg0_type,
+                        static_cast<int>(shape_size(arg0_shape)),
+                        root_id);
+                    auto memSize = static_cast<int>(shape_size(arg0_shape)) * sizeof(T);
+                    memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), memSize);
+                }
+                else
+                {
+                    reference::broadcastdistributed<T>(
+                        out[0]->get_data_ptr<T>(),
+                        arg0_type,
+                        static_cast<int>(shape_size(arg0_shape)),
+                        root_id);
+                }
+            };
+        }
+        case OP_TYPEID::BroadcastLike: return skip_op;
         case OP_TYPEID::Ceiling:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::ceiling<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::ceiling<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Concat:
         {
             const op::Concat* concat = static_cast<const op::Concat*>(&node);
-            std::vector<const T*> in_args;
-            std::vector<Shape> in_shapes;
-            for (size_t i = 0; i < node.get_input_size(); i++)
-            {
-                in_args.push_back(args[i]->get_data_ptr<const T>());
-                in_shapes.push_back(node.get_input_shape(i));
-            }
-            reference::concat<T>(in_args,
-                                 out[0]->get_data_ptr<T>(),
-                                 in_shapes,
-                                 node.get_output_shape(0),
-                                 concat->get_concatenation_axis());
-            break;
+            Shape out0_shape = node.get_output_shape(0);
+            auto concatenation_axis = concat->get_concatenation_axis();
+            return [=, &node](const HostTensorVector& out, const HostTensorVector& args) {
+                std::vector<const T*> in_args;
+                std::vector<Shape> in_shapes;
+                for (size_t i = 0; i < node.get_input_size(); i++)
+                {
+                    in_args.push_back(args[i]->get_data_ptr<const T>());
+                    in_shapes.push_back(node.get_input_shape(i));
+                }
+                reference::concat<T>(
+                    in_args, out[0]->get_data_ptr<T>(), in_shapes, out0_shape, concatenation_axis);
+            };
         }
         case OP_TYPEID::Constant:
         {
             const op::Constant* c = static_cast<const op::Constant*>(&node);
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::constant<T>(c->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& /* args */) {
+                reference::constant<T>(
+                    c->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
-        case OP_TYPEID::ScalarConstantLike: break;
+        case OP_TYPEID::ScalarConstantLike: return skip_op;
         case OP_TYPEID::Convert:
         {
             // const op::Convert* c = static_cast<const op::Convert*>(&node);
             element::Type type = node.get_element_type();
-            std::stringstream ss;
-            size_t element_count = shape_size(node.get_output_shape(0));
-            switch (type)
-            {
-            case element::Type_t::boolean:
-                reference::convert_to_bool<T>(
-                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<char>(), element_count);
-                break;
-            case element::Type_t::f32:
-                reference::convert<T>(
-                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<float>(), element_count);
-                break;
-            case element::Type_t::f64:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<double>(),
-                                      element_count);
-                break;
-            case element::Type_t::i8:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<int8_t>(),
-                                      element_count);
-                break;
-            case element::Type_t::i16:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<int16_t>(),
-                                      element_count);
-                break;
-            case element::Type_t::i32:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<int32_t>(),
-                                      element_count);
-                break;
-            case element::Type_t::i64:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<int64_t>(),
-                                      element_count);
-                break;
-            case element::Type_t::u8:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<uint8_t>(),
-                                      element_count);
-                break;
-            case element::Type_t::u16:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<uint16_t>(),
-                                      element_count);
-                break;
-            case element::Type_t::u32:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<uint32_t>(),
-                                      element_count);
-                break;
-            case element::Type_t::u64:
-                reference::convert<T>(args[0]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<uint64_t>(),
-                                      element_count);
-                break;
-            case element::Type_t::undefined:
-            case element::Type_t::dynamic:
-            case element::Type_t::bf16:
-            case element::Type_t::f16:
-                ss << "unsupported element type " << type << " op Convert";
-                throw std::runtime_error(ss.str());
-            }
-            break;
+            Shape out0_shape = node.get_output_shape(0);
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                std::stringstream ss;
+                size_t element_count = shape_size(out0_shape);
+                switch (type)
+                {
+                case element::Type_t::boolean:
+                    reference::convert_to_bool<T>(args[0]->get_data_ptr<const T>(),
+                                                  out[0]->get_data_ptr<char>(),
+                                                  element_count);
+                    break;
+                case element::Type_t::f32:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<float>(),
+                                          element_count);
+                    break;
+                case element::Type_t::f64:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<double>(),
+                                          element_count);
+                    break;
+                case element::Type_t::i8:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<int8_t>(),
+                                          element_count);
+                    break;
+                case element::Type_t::i16:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<int16_t>(),
+                                          element_count);
+                    break;
+                case element::Type_t::i32:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<int32_t>(),
+                                          element_count);
+                    break;
+                case element::Type_t::i64:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<int64_t>(),
+                                          element_count);
+                    break;
+                case element::Type_t::u8:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<uint8_t>(),
+                                          element_count);
+                    break;
+                case element::Type_t::u16:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<uint16_t>(),
+                                          element_count);
+                    break;
+                case element::Type_t::u32:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<uint32_t>(),
+                                          element_count);
+                    break;
+                case element::Type_t::u64:
+                    reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<uint64_t>(),
+                                          element_count);
+                    break;
+                case element::Type_t::undefined:
+                case element::Type_t::dynamic:
+                case element::Type_t::bf16:
+                case element::Type_t::f16:
+                    ss << "unsupported element type " << type << " op Convert";
+                    throw std::runtime_error(ss.str());
+                }
+            };
         }
         case OP_TYPEID::Convolution:
         {
             const op::Convolution* c = static_cast<const op::Convolution*>(&node);
-            reference::convolution<T>(args[0]->get_data_ptr<const T>(),
-                                      args[1]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<T>(),
-                                      node.get_input_shape(0),
-                                      node.get_input_shape(1),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides(),
-                                      c->get_window_dilation_strides(),
-                                      c->get_padding_below(),
-                                      c->get_padding_above(),
-                                      c->get_data_dilation_strides());
-
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            auto data_dilation_strides = c->get_data_dilation_strides();
+            auto padding_above = c->get_padding_above();
+            auto padding_below = c->get_padding_below();
+            auto window_dilation_strides = c->get_window_dilation_strides();
+            auto window_movement_strides = c->get_window_movement_strides();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::convolution<T>(args[0]->get_data_ptr<const T>(),
+                                          args[1]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<T>(),
+                                          arg0_shape,
+                                          arg1_shape,
+                                          out0_shape,
+                                          window_movement_strides,
+                                          window_dilation_strides,
+                                          padding_below,
+                                          padding_above,
+                                          data_dilation_strides);
+            };
         }
         case OP_TYPEID::ConvolutionBackpropFilters:
         {
             const op::ConvolutionBackpropFilters* c =
                 static_cast<const op::ConvolutionBackpropFilters*>(&node);
-            reference::convolution_backprop_filter<T>(
-                args[0]->get_data_ptr<const T>(), // input
-                args[1]->get_data_ptr<const T>(), // delta_convolution_output
-                out[0]->get_data_ptr<T>(),        // delta_filter
-                c->get_input_shape(0),            // input_shape
-                c->get_input_shape(1),            // convolution_output_shape
-                c->get_filters_shape(),           // filter_shape
-                c->get_window_dilation_strides_forward(),
-                c->get_window_movement_strides_forward(),
-                c->get_padding_below_forward(),
-                c->compute_backward_in_pad_above(),
-                c->get_data_dilation_strides_forward());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto backward_in_pad_above = c->compute_backward_in_pad_above();
+            auto data_dilation_strides_forward = c->get_data_dilation_strides_forward();
+            auto filters_shape = c->get_filters_shape();
+            auto padding_below_forward = c->get_padding_below_forward();
+            auto window_dilation_strides_forward = c->get_window_dilation_strides_forward();
+            auto window_movement_strides_forward = c->get_window_movement_strides_forward();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::convolution_backprop_filter<T>(
+                    args[0]->get_data_ptr<const T>(), // input
+                    args[1]->get_data_ptr<const T>(), // delta_convolution_output
+                    out[0]->get_data_ptr<T>(),        // delta_filter
+                    arg0_shape,            // input_shape
+                    arg1_shape,            // convolution_output_shape
+                    filters_shape,           // filter_shape
+                    window_dilation_strides_forward,
+                    window_movement_strides_forward,
+                    padding_below_forward,
+                    backward_in_pad_above,
+                    data_dilation_strides_forward);
+            };
         }
         case OP_TYPEID::ConvolutionBackpropData:
         {
-            // Note that args[1] and args[0] are switched here from the usual order.
-            const op::ConvolutionBackpropData* c =
-                static_cast<const op::ConvolutionBackpropData*>(&node);
-            reference::convolution_backprop_in<T>(args[1]->get_data_ptr<const T>(),
-                                                  args[0]->get_data_ptr<const T>(),
-                                                  out[0]->get_data_ptr<T>(),
-                                                  c->get_input_shape(1),
-                                                  c->get_input_shape(0),
-                                                  c->get_data_batch_shape(),
-                                                  c->get_data_dilation_strides_forward(),
-                                                  c->get_window_dilation_strides_forward(),
-                                                  c->compute_backward_delta_out_pad_below(),
-                                                  c->compute_backward_delta_out_pad_above(),
-                                                  c->get_window_movement_strides_forward());
-            break;
+            return [=, &node](const HostTensorVector& out, const HostTensorVector& args) {
+                // Note that args[1] and args[0] are switched here from the usual order.
+                const op::ConvolutionBackpropData* c =
+                    static_cast<const op::ConvolutionBackpropData*>(&node);
+                reference::convolution_backprop_in<T>(args[1]->get_data_ptr<const T>(),
+                                                      args[0]->get_data_ptr<const T>(),
+                                                      out[0]->get_data_ptr<T>(),
+                                                      c->get_input_shape(1),
+                                                      c->get_input_shape(0),
+                                                      c->get_data_batch_shape(),
+                                                      c->get_data_dilation_strides_forward(),
+                                                      c->get_window_dilation_strides_forward(),
+                                                      c->compute_backward_delta_out_pad_below(),
+                                                      c->compute_backward_delta_out_pad_above(),
+                                                      c->get_window_movement_strides_forward());
+            };
         }
         case OP_TYPEID::Cos:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::cos<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::cos<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Cosh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::cosh<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::cosh<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Dequantize:
         {
             const op::Dequantize* dequantize = static_cast<const op::Dequantize*>(&node);
             auto type = dequantize->get_element_type();
-
-            if (type == element::f32)
-            {
-                reference::dequantize<T>(args[0]->get_data_ptr<const T>(),
-                                         args[1]->get_data_ptr<const float>(),
-                                         args[2]->get_data_ptr<const T>(),
-                                         out[0]->get_data_ptr<float>(),
-                                         node.get_input_shape(0),
-                                         node.get_input_shape(1),
-                                         dequantize->get_axes());
-            }
-            else if (type == element::f64)
-            {
-                reference::dequantize<T>(args[0]->get_data_ptr<const T>(),
-                                         args[1]->get_data_ptr<const double>(),
-                                         args[2]->get_data_ptr<const T>(),
-                                         out[0]->get_data_ptr<double>(),
-                                         node.get_input_shape(0),
-                                         node.get_input_shape(1),
-                                         dequantize->get_axes());
-            }
-            else
-            {
-                std::stringstream ss;
-                ss << "unsupported element type " << type << " op Dequantize";
-                throw std::runtime_error(ss.str());
-            }
-
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto axes = dequantize->get_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (type == element::f32)
+                {
+                    reference::dequantize<T>(args[0]->get_data_ptr<const T>(),
+                                             args[1]->get_data_ptr<const float>(),
+                                             args[2]->get_data_ptr<const T>(),
+                                             out[0]->get_data_ptr<float>(),
+                                             arg0_shape,
+                                             arg1_shape,
+                                             axes);
+                }
+                else if (type == element::f64)
+                {
+                    reference::dequantize<T>(args[0]->get_data_ptr<const T>(),
+                                             args[1]->get_data_ptr<const double>(),
+                                             args[2]->get_data_ptr<const T>(),
+                                             out[0]->get_data_ptr<double>(),
+                                             arg0_shape,
+                                             arg1_shape,
+                                             axes);
+                }
+                else
+                {
+                    std::stringstream ss;
+                    ss << "unsupported element type " << type << " op Dequantize";
+                    throw std::runtime_error(ss.str());
+                }
+            };
         }
         case OP_TYPEID::Divide:
         {
             const op::Divide* divop = static_cast<const op::Divide*>(&node);
-            reference::divide<T>(args[0]->get_data_ptr<const T>(),
-                                 args[1]->get_data_ptr<const T>(),
-                                 out[0]->get_data_ptr<T>(),
-                                 node.get_input_shape(0),
-                                 node.get_input_shape(1),
-                                 divop->get_autob(),
-                                 divop->is_pythondiv());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = divop->get_autob();
+            auto divop_is_pythondiv = divop->is_pythondiv();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::divide<T>(args[0]->get_data_ptr<const T>(),
+                                     args[1]->get_data_ptr<const T>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     arg0_shape,
+                                     arg1_shape,
+                                     autob,
+                                     divop_is_pythondiv);
+            };
         }
         case OP_TYPEID::Dot:
         {
             const op::Dot* dot = static_cast<const op::Dot*>(&node);
-
-            reference::dot(args[0]->get_data_ptr<const T>(),
-                           args[1]->get_data_ptr<const T>(),
-                           out[0]->get_data_ptr<T>(),
-                           node.get_input_shape(0),
-                           node.get_input_shape(1),
-                           node.get_output_shape(0),
-                           dot->get_reduction_axes_count());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axes_count = dot->get_reduction_axes_count();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::dot(args[0]->get_data_ptr<const T>(),
+                               args[1]->get_data_ptr<const T>(),
+                               out[0]->get_data_ptr<T>(),
+                               arg0_shape,
+                               arg1_shape,
+                               out0_shape,
+                               reduction_axes_count);
+            };
         }
         case OP_TYPEID::DynReshape:
         {
-            throw unsupported_op("Unsupported op '" + node.description() + "'");
-            break;
+            return unsupported_op_kernel("Unsupported op '" + node.description() + "'");
         }
         case OP_TYPEID::DynSlice:
         {
-            throw unsupported_op("Unsupported op '" + node.description() + "'");
-            break;
+            return unsupported_op_kernel("Unsupported op '" + node.description() + "'");
         }
         case OP_TYPEID::EmbeddingLookup:
         {
             const op::EmbeddingLookup* embed = static_cast<const op::EmbeddingLookup*>(&node);
             auto type = embed->get_argument(0)->get_element_type();
             size_t element_count = shape_size(embed->get_argument(0)->get_shape());
-
-            if (type == element::f32)
-            {
-                reference::embedding<T, float>(args[0]->get_data_ptr<const float>(),
-                                               args[1]->get_data_ptr<const T>(),
-                                               out[0]->get_data_ptr<T>(),
-                                               element_count,
-                                               embed->get_shape());
-            }
-            else if (type == element::f64)
-            {
-                reference::embedding<T, double>(args[0]->get_data_ptr<const double>(),
-                                                args[1]->get_data_ptr<const T>(),
-                                                out[0]->get_data_ptr<T>(),
-                                                element_count,
-                                                embed->get_shape());
-            }
-            else if (type == element::i32)
-            {
-                reference::embedding<T, int32_t>(args[0]->get_data_ptr<const int>(),
-                                                 args[1]->get_data_ptr<const T>(),
-                                                 out[0]->get_data_ptr<T>(),
-                                                 element_count,
-                                                 embed->get_shape());
-            }
-            else if (type == element::i64)
-            {
-                reference::embedding<T, int64_t>(args[0]->get_data_ptr<const int64_t>(),
-                                                 args[1]->get_data_ptr<const T>(),
-                                                 out[0]->get_data_ptr<T>(),
-                                                 element_count,
-                                                 embed->get_shape());
-            }
-            else
-            {
-                throw ngraph_error(std::string("Unsupported index type ") + type.c_type_string() +
-                                   std::string("in EmbeddingLookup"));
-            }
-            break;
+            auto shape = embed->get_shape();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (type == element::f32)
+                {
+                    reference::embedding<T, float>(args[0]->get_data_ptr<const float>(),
+                                                   args[1]->get_data_ptr<const T>(),
+                                                   out[0]->get_data_ptr<T>(),
+                                                   element_count,
+                                                   shape);
+                }
+                else if (type == element::f64)
+                {
+                    reference::embedding<T, double>(args[0]->get_data_ptr<const double>(),
+                                                    args[1]->get_data_ptr<const T>(),
+                                                    out[0]->get_data_ptr<T>(),
+                                                    element_count,
+                                                    shape);
+                }
+                else if (type == element::i32)
+                {
+                    reference::embedding<T, int32_t>(args[0]->get_data_ptr<const int>(),
+                                                     args[1]->get_data_ptr<const T>(),
+                                                     out[0]->get_data_ptr<T>(),
+                                                     element_count,
+                                                     shape);
+                }
+                else if (type == element::i64)
+                {
+                    reference::embedding<T, int64_t>(args[0]->get_data_ptr<const int64_t>(),
+                                                     args[1]->get_data_ptr<const T>(),
+                                                     out[0]->get_data_ptr<T>(),
+                                                     element_count,
+                                                     shape);
+                }
+                else
+                {
+                    throw ngraph_error(std::string("Unsupported index type ") +
+                                       type.c_type_string() + std::string("in EmbeddingLookup"));
+                }
+            };
         }
         case OP_TYPEID::Equal:
         {
             auto equal = static_cast<const op::Equal*>(&node);
-            reference::equal<T>(args[0]->get_data_ptr<const T>(),
-                                args[1]->get_data_ptr<const T>(),
-                                out[0]->get_data_ptr<char>(),
-                                node.get_input_shape(0),
-                                node.get_input_shape(1),
-                                equal->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = equal->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::equal<T>(args[0]->get_data_ptr<const T>(),
+                                    args[1]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<char>(),
+                                    arg0_shape,
+                                    arg1_shape,
+                                    autob);
+            };
         }
         case OP_TYPEID::Erf:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::erf<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::erf<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Exp:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::exp<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::exp<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
 #ifdef INTERPRETER_USE_HYBRID
         case OP_TYPEID::FunctionCall:
@@ -891,412 +1063,527 @@ private:
             auto f = static_cast<const runtime::hybrid::op::FunctionCall*>(&node);
             auto backend = f->get_backend();
             auto executable = f->get_executable();
-
-            std::vector<std::shared_ptr<Tensor>> outputs;
-            std::vector<std::shared_ptr<Tensor>> inputs;
-            for (const std::shared_ptr<HostTensor>& t : out)
-            {
-                auto backend_tensor = backend->create_tensor(
-                    t->get_element_type(), t->get_shape(), t->get_data_ptr());
-                outputs.push_back(backend_tensor);
-            }
-            for (const std::shared_ptr<HostTensor>& t : args)
-            {
-                auto backend_tensor = backend->create_tensor(
-                    t->get_element_type(), t->get_shape(), t->get_data_ptr());
-                inputs.push_back(backend_tensor);
-            }
-            executable->call(outputs, inputs);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                std::vector<std::shared_ptr<Tensor>> outputs;
+                std::vector<std::shared_ptr<Tensor>> inputs;
+                for (const std::shared_ptr<HostTensor>& t : out)
+                {
+                    auto backend_tensor = backend->create_tensor(
+                        t->get_element_type(), t->get_shape(), t->get_data_ptr());
+                    outputs.push_back(backend_tensor);
+                }
+                for (const std::shared_ptr<HostTensor>& t : args)
+                {
+                    auto backend_tensor = backend->create_tensor(
+                        t->get_element_type(), t->get_shape(), t->get_data_ptr());
+                    inputs.push_back(backend_tensor);
+                }
+                executable->call(outputs, inputs);
+            };
         }
 #endif
         case OP_TYPEID::Floor:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::floor<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::floor<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Gather:
         {
             const op::Gather* gather = static_cast<const op::Gather*>(&node);
-            if (node.get_input_element_type(1) == element::i64)
-            {
-                reference::gather<T, int64_t>(args[0]->get_data_ptr<T>(),
-                                              args[1]->get_data_ptr<int64_t>(),
-                                              out[0]->get_data_ptr<T>(),
-                                              node.get_input_shape(0),
-                                              node.get_input_shape(1),
-                                              node.get_output_shape(0),
-                                              gather->get_axis());
-            }
-            else if (node.get_input_element_type(1) == element::i32)
-            {
-                reference::gather<T, int32_t>(args[0]->get_data_ptr<T>(),
-                                              args[1]->get_data_ptr<int32_t>(),
-                                              out[0]->get_data_ptr<T>(),
-                                              node.get_input_shape(0),
-                                              node.get_input_shape(1),
-                                              node.get_output_shape(0),
-                                              gather->get_axis());
-            }
-            else
-            {
-                throw ngraph_error("Unexpected type");
-            }
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            element::Type arg1_type = node.get_input_element_type(1);
+            auto axis = gather->get_axis();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (arg1_type == element::i64)
+                {
+                    reference::gather<T, int64_t>(args[0]->get_data_ptr<T>(),
+                                                  args[1]->get_data_ptr<int64_t>(),
+                                                  out[0]->get_data_ptr<T>(),
+                                                  arg0_shape,
+                                                  arg1_shape,
+                                                  out0_shape,
+                                                  axis);
+                }
+                else if (arg1_type == element::i32)
+                {
+                    reference::gather<T, int32_t>(args[0]->get_data_ptr<T>(),
+                                                  args[1]->get_data_ptr<int32_t>(),
+                                                  out[0]->get_data_ptr<T>(),
+                                                  arg0_shape,
+                                                  arg1_shape,
+                                                  out0_shape,
+                                                  axis);
+                }
+                else
+                {
+                    throw ngraph_error("Unexpected type");
+                }
+            };
         }
         case OP_TYPEID::GatherND:
         {
-            if (node.get_input_element_type(1) == element::i64)
-            {
-                reference::gather_nd<T, int64_t>(args[0]->get_data_ptr<T>(),
-                                                 args[1]->get_data_ptr<int64_t>(),
-                                                 out[0]->get_data_ptr<T>(),
-                                                 node.get_input_shape(0),
-                                                 node.get_input_shape(1),
-                                                 node.get_output_shape(0));
-            }
-            else if (node.get_input_element_type(1) == element::i32)
-            {
-                reference::gather_nd<T, int32_t>(args[0]->get_data_ptr<T>(),
-                                                 args[1]->get_data_ptr<int32_t>(),
-                                                 out[0]->get_data_ptr<T>(),
-                                                 node.get_input_shape(0),
-                                                 node.get_input_shape(1),
-                                                 node.get_output_shape(0));
-            }
-            else
-            {
-                throw ngraph_error("Unexpected type");
-            }
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            element::Type arg1_type = node.get_input_element_type(1);
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (arg1_type == element::i64)
+                {
+                    reference::gather_nd<T, int64_t>(args[0]->get_data_ptr<T>(),
+                                                     args[1]->get_data_ptr<int64_t>(),
+                                                     out[0]->get_data_ptr<T>(),
+                                                     arg0_shape,
+                                                     arg1_shape,
+                                                     out0_shape);
+                }
+                else if (arg1_type == element::i32)
+                {
+                    reference::gather_nd<T, int32_t>(args[0]->get_data_ptr<T>(),
+                                                     args[1]->get_data_ptr<int32_t>(),
+                                                     out[0]->get_data_ptr<T>(),
+                                                     arg0_shape,
+                                                     arg1_shape,
+                                                     out0_shape);
+                }
+                else
+                {
+                    throw ngraph_error("Unexpected type");
+                }
+            };
         }
         case OP_TYPEID::Greater:
         {
             auto greater = static_cast<const op::Greater*>(&node);
-            reference::greater<T>(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<char>(),
-                                  node.get_input_shape(0),
-                                  node.get_input_shape(1),
-                                  greater->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = greater->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::greater<T>(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<char>(),
+                                      arg0_shape,
+                                      arg1_shape,
+                                      autob);
+            };
         }
         case OP_TYPEID::GreaterEq:
         {
             auto greater_eq = static_cast<const op::GreaterEq*>(&node);
-            reference::greater_eq<T>(args[0]->get_data_ptr<const T>(),
-                                     args[1]->get_data_ptr<const T>(),
-                                     out[0]->get_data_ptr<char>(),
-                                     node.get_input_shape(0),
-                                     node.get_input_shape(1),
-                                     greater_eq->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = greater_eq->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::greater_eq<T>(args[0]->get_data_ptr<const T>(),
+                                         args[1]->get_data_ptr<const T>(),
+                                         out[0]->get_data_ptr<char>(),
+                                         arg0_shape,
+                                         arg1_shape,
+                                         autob);
+            };
         }
         case OP_TYPEID::Less:
         {
             auto less = static_cast<const op::Less*>(&node);
-            reference::less<T>(args[0]->get_data_ptr<const T>(),
-                               args[1]->get_data_ptr<const T>(),
-                               out[0]->get_data_ptr<char>(),
-                               node.get_input_shape(0),
-                               node.get_input_shape(1),
-                               less->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = less->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::less<T>(args[0]->get_data_ptr<const T>(),
+                                   args[1]->get_data_ptr<const T>(),
+                                   out[0]->get_data_ptr<char>(),
+                                   arg0_shape,
+                                   arg1_shape,
+                                   autob);
+            };
         }
         case OP_TYPEID::LessEq:
         {
             auto less_eq = static_cast<const op::LessEq*>(&node);
-            reference::less_eq<T>(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<char>(),
-                                  node.get_input_shape(0),
-                                  node.get_input_shape(1),
-                                  less_eq->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = less_eq->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::less_eq<T>(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<char>(),
+                                      arg0_shape,
+                                      arg1_shape,
+                                      autob);
+            };
         }
         case OP_TYPEID::LessEqual:
         {
             auto less_eq = static_cast<const op::v1::LessEqual*>(&node);
-            reference::less_eq<T>(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<char>(),
-                                  node.get_input_shape(0),
-                                  node.get_input_shape(1),
-                                  less_eq->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = less_eq->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::less_eq<T>(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<char>(),
+                                      arg0_shape,
+                                      arg1_shape,
+                                      autob);
+            };
         }
         case OP_TYPEID::Log:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::log<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::log<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::LogicalAnd:
         {
             auto logical_and = static_cast<const op::v1::LogicalAnd*>(&node);
-            reference::logical_and(args[0]->get_data_ptr<const T>(),
-                                   args[1]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_input_shape(1),
-                                   logical_and->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = logical_and->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::logical_and(args[0]->get_data_ptr<const T>(),
+                                       args[1]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg0_shape,
+                                       arg1_shape,
+                                       autob);
+            };
         }
         case OP_TYPEID::LogicalOr:
         {
             auto logical_or = static_cast<const op::v1::LogicalOr*>(&node);
-            reference::logical_or(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  node.get_input_shape(0),
-                                  node.get_input_shape(1),
-                                  logical_or->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = logical_or->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::logical_or(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      arg0_shape,
+                                      arg1_shape,
+                                      autob);
+            };
         }
         case OP_TYPEID::LogicalXor:
         {
             auto logical_xor = static_cast<const op::v1::LogicalXor*>(&node);
-            reference::logical_xor(args[0]->get_data_ptr<const T>(),
-                                   args[1]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_input_shape(1),
-                                   logical_xor->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = logical_xor->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::logical_xor(args[0]->get_data_ptr<const T>(),
+                                       args[1]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg0_shape,
+                                       arg1_shape,
+                                       autob);
+            };
         }
         case OP_TYPEID::LRN:
         {
             const op::LRN* lrn = static_cast<const op::LRN*>(&node);
-            reference::lrn<T>(args[0]->get_data_ptr<const T>(),
-                              lrn->get_reduction_axes(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              lrn->get_alpha(),
-                              lrn->get_beta(),
-                              lrn->get_bias(),
-                              lrn->get_nsize());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            auto alpha = lrn->get_alpha();
+            auto beta = lrn->get_beta();
+            auto bias = lrn->get_bias();
+            auto nsize = lrn->get_nsize();
+            auto reduction_axes = lrn->get_reduction_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::lrn<T>(args[0]->get_data_ptr<const T>(),
+                                  reduction_axes,
+                                  out[0]->get_data_ptr<T>(),
+                                  arg0_shape,
+                                  alpha,
+                                  beta,
+                                  bias,
+                                  nsize);
+            };
         }
         case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
-            reference::max<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              max->get_reduction_axes());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axes = max->get_reduction_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::max<T>(args[0]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  arg0_shape,
+                                  out0_shape,
+                                  reduction_axes);
+            };
         }
         case OP_TYPEID::Maximum:
         {
             auto maximum = static_cast<const op::Maximum*>(&node);
-            reference::maximum<T>(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  node.get_input_shape(0),
-                                  node.get_input_shape(1),
-                                  maximum->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = maximum->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::maximum<T>(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      arg0_shape,
+                                      arg1_shape,
+                                      autob);
+            };
         }
         case OP_TYPEID::MaxPool:
         {
             const op::MaxPool* max_pool = static_cast<const op::MaxPool*>(&node);
-
-            reference::max_pool<T>(args[0]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   max_pool->get_window_shape(),
-                                   max_pool->get_window_movement_strides(),
-                                   max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto padding_above = max_pool->get_padding_above();
+            auto padding_below = max_pool->get_padding_below();
+            auto window_movement_strides = max_pool->get_window_movement_strides();
+            auto window_shape = max_pool->get_window_shape();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::max_pool<T>(args[0]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg0_shape,
+                                       out0_shape,
+                                       window_shape,
+                                       window_movement_strides,
+                                       padding_below,
+                                       padding_above);
+            };
         }
         case OP_TYPEID::MaxPoolBackprop:
         {
             const op::MaxPoolBackprop* max_pool_backprop =
                 static_cast<const op::MaxPoolBackprop*>(&node);
-
-            reference::max_pool_backprop<T>(args[0]->get_data_ptr<const T>(),
-                                            args[1]->get_data_ptr<const T>(),
-                                            out[0]->get_data_ptr<T>(),
-                                            node.get_input_shape(1),
-                                            node.get_output_shape(0),
-                                            max_pool_backprop->get_window_shape(),
-                                            max_pool_backprop->get_window_movement_strides(),
-                                            max_pool_backprop->get_padding_below(),
-                                            max_pool_backprop->get_padding_above());
-            break;
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            auto padding_above = max_pool_backprop->get_padding_above();
+            auto padding_below = max_pool_backprop->get_padding_below();
+            auto window_movement_strides = max_pool_backprop->get_window_movement_strides();
+            auto window_shape = max_pool_backprop->get_window_shape();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::max_pool_backprop<T>(args[0]->get_data_ptr<const T>(),
+                                                args[1]->get_data_ptr<const T>(),
+                                                out[0]->get_data_ptr<T>(),
+                                                arg1_shape,
+                                                out0_shape,
+                                                window_shape,
+                                                window_movement_strides,
+                                                padding_below,
+                                                padding_above);
+            };
         }
         case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
-            reference::min<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              min->get_reduction_axes());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axes = min->get_reduction_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::min<T>(args[0]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  arg0_shape,
+                                  out0_shape,
+                                  reduction_axes);
+            };
         }
         case OP_TYPEID::Minimum:
         {
             auto minimum = static_cast<const op::Minimum*>(&node);
-            reference::minimum<T>(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  node.get_input_shape(0),
-                                  node.get_input_shape(1),
-                                  minimum->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = minimum->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::minimum<T>(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      arg0_shape,
+                                      arg1_shape,
+                                      autob);
+            };
         }
         case OP_TYPEID::Multiply:
         {
             auto multiply = static_cast<const op::Multiply*>(&node);
-            reference::multiply<T>(args[0]->get_data_ptr<const T>(),
-                                   args[1]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_input_shape(1),
-                                   multiply->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = multiply->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::multiply<T>(args[0]->get_data_ptr<const T>(),
+                                       args[1]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg0_shape,
+                                       arg1_shape,
+                                       autob);
+            };
         }
         case OP_TYPEID::Negative:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::negate<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::negate<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::LogicalNot:
         case OP_TYPEID::Not:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::logical_not(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::logical_not(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::NotEqual:
         {
             auto not_equal = static_cast<const op::NotEqual*>(&node);
-            reference::not_equal<T>(args[0]->get_data_ptr<const T>(),
-                                    args[1]->get_data_ptr<const T>(),
-                                    out[0]->get_data_ptr<char>(),
-                                    node.get_input_shape(0),
-                                    node.get_input_shape(1),
-                                    not_equal->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = not_equal->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::not_equal<T>(args[0]->get_data_ptr<const T>(),
+                                        args[1]->get_data_ptr<const T>(),
+                                        out[0]->get_data_ptr<char>(),
+                                        arg0_shape,
+                                        arg1_shape,
+                                        autob);
+            };
         }
         case OP_TYPEID::OneHot:
         {
             const op::OneHot* oh = static_cast<const op::OneHot*>(&node);
-            reference::one_hot<T>(args[0]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  node.get_input_shape(0),
-                                  node.get_output_shape(0),
-                                  oh->get_one_hot_axis());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto one_hot_axis = oh->get_one_hot_axis();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::one_hot<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      arg0_shape,
+                                      out0_shape,
+                                      one_hot_axis);
+            };
         }
         case OP_TYPEID::Or:
         {
             auto logical_or = static_cast<const op::Or*>(&node);
-            reference::logical_or(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  node.get_input_shape(0),
-                                  node.get_input_shape(1),
-                                  logical_or->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = logical_or->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::logical_or(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      arg0_shape,
+                                      arg1_shape,
+                                      autob);
+            };
         }
-        case OP_TYPEID::Parameter: break;
+        case OP_TYPEID::Parameter: return skip_op;
         case OP_TYPEID::Passthrough:
         {
             const op::Passthrough* passthrough = static_cast<const op::Passthrough*>(&node);
-            throw unsupported_op{"Unsupported operation language: " + passthrough->language()};
+            return unsupported_op_kernel("Unsupported operation language: " +
+                                         passthrough->language());
         }
         case OP_TYPEID::Pad:
         {
             const op::Pad* pad = static_cast<const op::Pad*>(&node);
-
-            reference::pad(args[0]->get_data_ptr<const T>(),
-                           args[1]->get_data_ptr<const T>(),
-                           out[0]->get_data_ptr<T>(),
-                           node.input(0).get_shape(),
-                           node.output(0).get_shape(),
-                           pad->get_padding_below(),
-                           pad->get_padding_above(),
-                           pad->get_pad_mode());
-            break;
+            Shape arg0_shape = node.input(0).get_shape();
+            Shape out0_shape = node.output(0).get_shape();
+            auto pad_mode = pad->get_pad_mode();
+            auto padding_above = pad->get_padding_above();
+            auto padding_below = pad->get_padding_below();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::pad(args[0]->get_data_ptr<const T>(),
+                               args[1]->get_data_ptr<const T>(),
+                               out[0]->get_data_ptr<T>(),
+                               arg0_shape,
+                               out0_shape,
+                               padding_below,
+                               padding_above,
+                               pad_mode);
+            };
         }
         case OP_TYPEID::Power:
         {
             auto power = static_cast<const op::Power*>(&node);
-            reference::power<T>(args[0]->get_data_ptr<const T>(),
-                                args[1]->get_data_ptr<const T>(),
-                                out[0]->get_data_ptr<T>(),
-                                node.get_input_shape(0),
-                                node.get_input_shape(1),
-                                power->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = power->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::power<T>(args[0]->get_data_ptr<const T>(),
+                                    args[1]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    arg0_shape,
+                                    arg1_shape,
+                                    autob);
+            };
         }
         case OP_TYPEID::Product:
         {
             const op::Product* product = static_cast<const op::Product*>(&node);
-            reference::product<T>(args[0]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  node.get_input_shape(0),
-                                  node.get_output_shape(0),
-                                  product->get_reduction_axes());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axes = product->get_reduction_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::product<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      arg0_shape,
+                                      out0_shape,
+                                      reduction_axes);
+            };
         }
         case OP_TYPEID::Quantize:
         {
             const op::Quantize* quantize = static_cast<const op::Quantize*>(&node);
             auto type = quantize->get_element_type();
-
-            if (type == element::u8)
-            {
-                reference::quantize<T>(args[0]->get_data_ptr<const T>(),
-                                       args[1]->get_data_ptr<const T>(),
-                                       args[2]->get_data_ptr<const uint8_t>(),
-                                       out[0]->get_data_ptr<uint8_t>(),
-                                       node.get_input_shape(0),
-                                       node.get_input_shape(1),
-                                       quantize->get_axes(),
-                                       quantize->get_round_mode());
-            }
-            else if (type == element::i8)
-            {
-                reference::quantize<T>(args[0]->get_data_ptr<const T>(),
-                                       args[1]->get_data_ptr<const T>(),
-                                       args[2]->get_data_ptr<const int8_t>(),
-                                       out[0]->get_data_ptr<int8_t>(),
-                                       node.get_input_shape(0),
-                                       node.get_input_shape(1),
-                                       quantize->get_axes(),
-                                       quantize->get_round_mode());
-            }
-            else if (type == element::i32)
-            {
-                reference::quantize<T>(args[0]->get_data_ptr<const T>(),
-                                       args[1]->get_data_ptr<const T>(),
-                                       args[2]->get_data_ptr<const int32_t>(),
-                                       out[0]->get_data_ptr<int32_t>(),
-                                       node.get_input_shape(0),
-                                       node.get_input_shape(1),
-                                       quantize->get_axes(),
-                                       quantize->get_round_mode());
-            }
-            else
-            {
-                std::stringstream ss;
-                ss << "unsupported element type " << type << " op Quantize";
-                throw std::runtime_error(ss.str());
-            }
-
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto axes = quantize->get_axes();
+            auto round_mode = quantize->get_round_mode();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (type == element::u8)
+                {
+                    reference::quantize<T>(args[0]->get_data_ptr<const T>(),
+                                           args[1]->get_data_ptr<const T>(),
+                                           args[2]->get_data_ptr<const uint8_t>(),
+                                           out[0]->get_data_ptr<uint8_t>(),
+                                           arg0_shape,
+                                           arg1_shape,
+                                           axes,
+                                           round_mode);
+                }
+                else if (type == element::i8)
+                {
+                    reference::quantize<T>(args[0]->get_data_ptr<const T>(),
+                                           args[1]->get_data_ptr<const T>(),
+                                           args[2]->get_data_ptr<const int8_t>(),
+                                           out[0]->get_data_ptr<int8_t>(),
+                                           arg0_shape,
+                                           arg1_shape,
+                                           axes,
+                                           round_mode);
+                }
+                else if (type == element::i32)
+                {
+                    reference::quantize<T>(args[0]->get_data_ptr<const T>(),
+                                           args[1]->get_data_ptr<const T>(),
+                                           args[2]->get_data_ptr<const int32_t>(),
+                                           out[0]->get_data_ptr<int32_t>(),
+                                           arg0_shape,
+                                           arg1_shape,
+                                           axes,
+                                           round_mode);
+                }
+                else
+                {
+                    std::stringstream ss;
+                    ss << "unsupported element type " << type << " op Quantize";
+                    throw std::runtime_error(ss.str());
+                }
+            };
         }
 
         case OP_TYPEID::QuantizedConvolution:
@@ -1307,103 +1594,110 @@ private:
             auto input_element_type = qc->get_input_element_type(0);
             auto filter_element_type = qc->get_input_element_type(1);
             auto output_element_type = qc->get_output_element_type(0);
-
-            if (input_element_type == element::u8 && filter_element_type == element::i8 &&
-                output_element_type == element::i8)
-            {
-                reference::convolution<uint8_t, int8_t, int8_t, int32_t>(
-                    args[0]->get_data_ptr<const uint8_t>(),
-                    args[1]->get_data_ptr<const int8_t>(),
-                    out[0]->get_data_ptr<int8_t>(),
-                    node.get_input_shape(0),
-                    node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    qc->get_window_movement_strides(),
-                    qc->get_window_dilation_strides(),
-                    qc->get_padding_below(),
-                    qc->get_padding_above(),
-                    qc->get_data_dilation_strides(),
-                    args[2]->get_data_ptr<const float>(),
-                    args[3]->get_data_ptr<const uint8_t>(),
-                    args[4]->get_data_ptr<const float>(),
-                    args[5]->get_data_ptr<const int8_t>(),
-                    args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int8_t>());
-            }
-            else if (input_element_type == element::u8 && filter_element_type == element::u8 &&
-                     output_element_type == element::u8)
-            {
-                reference::convolution<uint8_t, uint8_t, uint8_t, int32_t>(
-                    args[0]->get_data_ptr<const uint8_t>(),
-                    args[1]->get_data_ptr<const uint8_t>(),
-                    out[0]->get_data_ptr<uint8_t>(),
-                    node.get_input_shape(0),
-                    node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    qc->get_window_movement_strides(),
-                    qc->get_window_dilation_strides(),
-                    qc->get_padding_below(),
-                    qc->get_padding_above(),
-                    qc->get_data_dilation_strides(),
-                    args[2]->get_data_ptr<const float>(),
-                    args[3]->get_data_ptr<const uint8_t>(),
-                    args[4]->get_data_ptr<const float>(),
-                    args[5]->get_data_ptr<const uint8_t>(),
-                    args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const uint8_t>());
-            }
-            else if (input_element_type == element::u8 && filter_element_type == element::i8 &&
-                     output_element_type == element::i32)
-            {
-                reference::convolution<uint8_t, int8_t, int32_t, int32_t>(
-                    args[0]->get_data_ptr<const uint8_t>(),
-                    args[1]->get_data_ptr<const int8_t>(),
-                    out[0]->get_data_ptr<int32_t>(),
-                    node.get_input_shape(0),
-                    node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    qc->get_window_movement_strides(),
-                    qc->get_window_dilation_strides(),
-                    qc->get_padding_below(),
-                    qc->get_padding_above(),
-                    qc->get_data_dilation_strides(),
-                    args[2]->get_data_ptr<const float>(),
-                    args[3]->get_data_ptr<const uint8_t>(),
-                    args[4]->get_data_ptr<const float>(),
-                    args[5]->get_data_ptr<const int8_t>(),
-                    args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int32_t>());
-            }
-            else if (input_element_type == element::u8 && filter_element_type == element::u8 &&
-                     output_element_type == element::i32)
-            {
-                reference::convolution<uint8_t, uint8_t, int32_t, int32_t>(
-                    args[0]->get_data_ptr<const uint8_t>(),
-                    args[1]->get_data_ptr<const uint8_t>(),
-                    out[0]->get_data_ptr<int32_t>(),
-                    node.get_input_shape(0),
-                    node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    qc->get_window_movement_strides(),
-                    qc->get_window_dilation_strides(),
-                    qc->get_padding_below(),
-                    qc->get_padding_above(),
-                    qc->get_data_dilation_strides(),
-                    args[2]->get_data_ptr<const float>(),
-                    args[3]->get_data_ptr<const uint8_t>(),
-                    args[4]->get_data_ptr<const float>(),
-                    args[5]->get_data_ptr<const uint8_t>(),
-                    args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int32_t>());
-            }
-            else
-            {
-                std::stringstream ss;
-                ss << "unsupported element type";
-                throw std::runtime_error(ss.str());
-            }
-
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            auto data_dilation_strides = qc->get_data_dilation_strides();
+            auto padding_above = qc->get_padding_above();
+            auto padding_below = qc->get_padding_below();
+            auto window_dilation_strides = qc->get_window_dilation_strides();
+            auto window_movement_strides = qc->get_window_movement_strides();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (input_element_type == element::u8 && filter_element_type == element::i8 &&
+                    output_element_type == element::i8)
+                {
+                    reference::convolution<uint8_t, int8_t, int8_t, int32_t>(
+                        args[0]->get_data_ptr<const uint8_t>(),
+                        args[1]->get_data_ptr<const int8_t>(),
+                        out[0]->get_data_ptr<int8_t>(),
+                        arg0_shape,
+                        arg1_shape,
+                        out0_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_dilation_strides,
+                        args[2]->get_data_ptr<const float>(),
+                        args[3]->get_data_ptr<const uint8_t>(),
+                        args[4]->get_data_ptr<const float>(),
+                        args[5]->get_data_ptr<const int8_t>(),
+                        args[6]->get_data_ptr<const float>(),
+                        args[7]->get_data_ptr<const int8_t>());
+                }
+                else if (input_element_type == element::u8 && filter_element_type == element::u8 &&
+                         output_element_type == element::u8)
+                {
+                    reference::convolution<uint8_t, uint8_t, uint8_t, int32_t>(
+                        args[0]->get_data_ptr<const uint8_t>(),
+                        args[1]->get_data_ptr<const uint8_t>(),
+                        out[0]->get_data_ptr<uint8_t>(),
+                        arg0_shape,
+                        arg1_shape,
+                        out0_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_dilation_strides,
+                        args[2]->get_data_ptr<const float>(),
+                        args[3]->get_data_ptr<const uint8_t>(),
+                        args[4]->get_data_ptr<const float>(),
+                        args[5]->get_data_ptr<const uint8_t>(),
+                        args[6]->get_data_ptr<const float>(),
+                        args[7]->get_data_ptr<const uint8_t>());
+                }
+                else if (input_element_type == element::u8 && filter_element_type == element::i8 &&
+                         output_element_type == element::i32)
+                {
+                    reference::convolution<uint8_t, int8_t, int32_t, int32_t>(
+                        args[0]->get_data_ptr<const uint8_t>(),
+                        args[1]->get_data_ptr<const int8_t>(),
+                        out[0]->get_data_ptr<int32_t>(),
+                        arg0_shape,
+                        arg1_shape,
+                        out0_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_dilation_strides,
+                        args[2]->get_data_ptr<const float>(),
+                        args[3]->get_data_ptr<const uint8_t>(),
+                        args[4]->get_data_ptr<const float>(),
+                        args[5]->get_data_ptr<const int8_t>(),
+                        args[6]->get_data_ptr<const float>(),
+                        args[7]->get_data_ptr<const int32_t>());
+                }
+                else if (input_element_type == element::u8 && filter_element_type == element::u8 &&
+                         output_element_type == element::i32)
+                {
+                    reference::convolution<uint8_t, uint8_t, int32_t, int32_t>(
+                        args[0]->get_data_ptr<const uint8_t>(),
+                        args[1]->get_data_ptr<const uint8_t>(),
+                        out[0]->get_data_ptr<int32_t>(),
+                        arg0_shape,
+                        arg1_shape,
+                        out0_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_dilation_strides,
+                        args[2]->get_data_ptr<const float>(),
+                        args[3]->get_data_ptr<const uint8_t>(),
+                        args[4]->get_data_ptr<const float>(),
+                        args[5]->get_data_ptr<const uint8_t>(),
+                        args[6]->get_data_ptr<const float>(),
+                        args[7]->get_data_ptr<const int32_t>());
+                }
+                else
+                {
+                    std::stringstream ss;
+                    ss << "unsupported element type";
+                    throw std::runtime_error(ss.str());
+                }
+            };
         }
 
         case OP_TYPEID::QuantizedConvolutionBias:
@@ -1418,87 +1712,89 @@ private:
             auto input0_element_type = qd->get_input_element_type(0);
             auto input1_element_type = qd->get_input_element_type(1);
             auto output_element_type = qd->get_output_element_type(0);
-
-            if (input0_element_type == element::u8 && input1_element_type == element::i8 &&
-                output_element_type == element::i8)
-            {
-                reference::dot<uint8_t, int8_t, int8_t, int32_t>(
-                    args[0]->get_data_ptr<const uint8_t>(),
-                    args[1]->get_data_ptr<const int8_t>(),
-                    out[0]->get_data_ptr<int8_t>(),
-                    node.get_input_shape(0),
-                    node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    1,
-                    args[2]->get_data_ptr<const float>(),
-                    args[3]->get_data_ptr<const uint8_t>(),
-                    args[4]->get_data_ptr<const float>(),
-                    args[5]->get_data_ptr<const int8_t>(),
-                    args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int8_t>());
-            }
-            else if (input0_element_type == element::u8 && input1_element_type == element::u8 &&
-                     output_element_type == element::u8)
-            {
-                reference::dot<uint8_t, uint8_t, uint8_t, int32_t>(
-                    args[0]->get_data_ptr<const uint8_t>(),
-                    args[1]->get_data_ptr<const uint8_t>(),
-                    out[0]->get_data_ptr<uint8_t>(),
-                    node.get_input_shape(0),
-                    node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    1,
-                    args[2]->get_data_ptr<const float>(),
-                    args[3]->get_data_ptr<const uint8_t>(),
-                    args[4]->get_data_ptr<const float>(),
-                    args[5]->get_data_ptr<const uint8_t>(),
-                    args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const uint8_t>());
-            }
-            else if (input0_element_type == element::u8 && input1_element_type == element::u8 &&
-                     output_element_type == element::i32)
-            {
-                reference::dot<uint8_t, uint8_t, int32_t, int32_t>(
-                    args[0]->get_data_ptr<const uint8_t>(),
-                    args[1]->get_data_ptr<const uint8_t>(),
-                    out[0]->get_data_ptr<int32_t>(),
-                    node.get_input_shape(0),
-                    node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    1,
-                    args[2]->get_data_ptr<const float>(),
-                    args[3]->get_data_ptr<const uint8_t>(),
-                    args[4]->get_data_ptr<const float>(),
-                    args[5]->get_data_ptr<const uint8_t>(),
-                    args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int32_t>());
-            }
-            else if (input0_element_type == element::u8 && input1_element_type == element::i8 &&
-                     output_element_type == element::i32)
-            {
-                reference::dot<uint8_t, int8_t, int32_t, int32_t>(
-                    args[0]->get_data_ptr<const uint8_t>(),
-                    args[1]->get_data_ptr<const int8_t>(),
-                    out[0]->get_data_ptr<int32_t>(),
-                    node.get_input_shape(0),
-                    node.get_input_shape(1),
-                    node.get_output_shape(0),
-                    1,
-                    args[2]->get_data_ptr<const float>(),
-                    args[3]->get_data_ptr<const uint8_t>(),
-                    args[4]->get_data_ptr<const float>(),
-                    args[5]->get_data_ptr<const int8_t>(),
-                    args[6]->get_data_ptr<const float>(),
-                    args[7]->get_data_ptr<const int32_t>());
-            }
-            else
-            {
-                std::stringstream ss;
-                ss << "unsupported element type";
-                throw std::runtime_error(ss.str());
-            }
-
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (input0_element_type == element::u8 && input1_element_type == element::i8 &&
+                    output_element_type == element::i8)
+                {
+                    reference::dot<uint8_t, int8_t, int8_t, int32_t>(
+                        args[0]->get_data_ptr<const uint8_t>(),
+                        args[1]->get_data_ptr<const int8_t>(),
+                        out[0]->get_data_ptr<int8_t>(),
+                        arg0_shape,
+                        arg1_shape,
+                        out0_shape,
+                        1,
+                        args[2]->get_data_ptr<const float>(),
+                        args[3]->get_data_ptr<const uint8_t>(),
+                        args[4]->get_data_ptr<const float>(),
+                        args[5]->get_data_ptr<const int8_t>(),
+                        args[6]->get_data_ptr<const float>(),
+                        args[7]->get_data_ptr<const int8_t>());
+                }
+                else if (input0_element_type == element::u8 && input1_element_type == element::u8 &&
+                         output_element_type == element::u8)
+                {
+                    reference::dot<uint8_t, uint8_t, uint8_t, int32_t>(
+                        args[0]->get_data_ptr<const uint8_t>(),
+                        args[1]->get_data_ptr<const uint8_t>(),
+                        out[0]->get_data_ptr<uint8_t>(),
+                        arg0_shape,
+                        arg1_shape,
+                        out0_shape,
+                        1,
+                        args[2]->get_data_ptr<const float>(),
+                        args[3]->get_data_ptr<const uint8_t>(),
+                        args[4]->get_data_ptr<const float>(),
+                        args[5]->get_data_ptr<const uint8_t>(),
+                        args[6]->get_data_ptr<const float>(),
+                        args[7]->get_data_ptr<const uint8_t>());
+                }
+                else if (input0_element_type == element::u8 && input1_element_type == element::u8 &&
+                         output_element_type == element::i32)
+                {
+                    reference::dot<uint8_t, uint8_t, int32_t, int32_t>(
+                        args[0]->get_data_ptr<const uint8_t>(),
+                        args[1]->get_data_ptr<const uint8_t>(),
+                        out[0]->get_data_ptr<int32_t>(),
+                        arg0_shape,
+                        arg1_shape,
+                        out0_shape,
+                        1,
+                        args[2]->get_data_ptr<const float>(),
+                        args[3]->get_data_ptr<const uint8_t>(),
+                        args[4]->get_data_ptr<const float>(),
+                        args[5]->get_data_ptr<const uint8_t>(),
+                        args[6]->get_data_ptr<const float>(),
+                        args[7]->get_data_ptr<const int32_t>());
+                }
+                else if (input0_element_type == element::u8 && input1_element_type == element::i8 &&
+                         output_element_type == element::i32)
+                {
+                    reference::dot<uint8_t, int8_t, int32_t, int32_t>(
+                        args[0]->get_data_ptr<const uint8_t>(),
+                        args[1]->get_data_ptr<const int8_t>(),
+                        out[0]->get_data_ptr<int32_t>(),
+                        arg0_shape,
+                        arg1_shape,
+                        out0_shape,
+                        1,
+                        args[2]->get_data_ptr<const float>(),
+                        args[3]->get_data_ptr<const uint8_t>(),
+                        args[4]->get_data_ptr<const float>(),
+                        args[5]->get_data_ptr<const int8_t>(),
+                        args[6]->get_data_ptr<const float>(),
+                        args[7]->get_data_ptr<const int32_t>());
+                }
+                else
+                {
+                    std::stringstream ss;
+                    ss << "unsupported element type";
+                    throw std::runtime_error(ss.str());
+                }
+            };
         }
         case OP_TYPEID::Recv:
         {
@@ -1506,195 +1802,230 @@ private:
             size_t memSize = element_count * sizeof(T);
             const auto* op = static_cast<const ngraph::op::Recv*>(&node);
             int src_id = op->get_src_id();
+            element::Type arg0_type = node.get_input_element_type(0);
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::recv<T>(args[0]->get_data_ptr<T>(), arg0_type, element_count, src_id);
 
-            reference::recv<T>(
-                args[0]->get_data_ptr<T>(), node.get_input_element_type(0), element_count, src_id);
-
-            memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), memSize);
-            break;
+                memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), memSize);
+            };
         }
         case OP_TYPEID::RandomUniform:
         {
             const op::RandomUniform* ru = static_cast<const op::RandomUniform*>(&node);
+            Shape out0_shape = node.get_output_shape(0);
+            auto fixed_seed = ru->get_fixed_seed();
+            return [=, &node](const HostTensorVector& out, const HostTensorVector& args) {
+                T min_val = args[0]->get_data_ptr<const T>()[0];
+                T max_val = args[1]->get_data_ptr<const T>()[0];
+                // In INTERPRETER we can ignore arg 2 (output_shape) for now because we only work on
+                // static output shapes anyway.
+                bool use_fixed_seed = static_cast<bool>(args[3]->get_data_ptr<const char>()[0]);
 
-            T min_val = args[0]->get_data_ptr<const T>()[0];
-            T max_val = args[1]->get_data_ptr<const T>()[0];
-            // In INTERPRETER we can ignore arg 2 (output_shape) for now because we only work on
-            // static output shapes anyway.
-            bool use_fixed_seed = static_cast<bool>(args[3]->get_data_ptr<const char>()[0]);
-
-            if (m_states.count(&node) == 0)
-            {
-                m_states[&node] = std::unique_ptr<UniformRNGState>(new UniformRNGState());
-            }
-
-            auto state = static_cast<UniformRNGState*>(m_states.at(&node).get());
-            size_t element_count = shape_size(node.get_output_shape(0));
-            if (!use_fixed_seed)
-            {
-                reference::random_uniform<T>(
-                    out[0]->get_data_ptr<T>(), min_val, max_val, element_count, state);
-            }
-            else
-            {
-                reference::random_uniform_with_fixed_seed<T>(out[0]->get_data_ptr<T>(),
-                                                             min_val,
-                                                             max_val,
-                                                             element_count,
-                                                             ru->get_fixed_seed());
-            }
-            break;
+                UniformRNGState* state;
+                {
+                    std::lock_guard<std::mutex> lock(m_states_mutex);
+                    if (m_states.count(&node) == 0)
+                    {
+                        m_states[&node] = std::unique_ptr<UniformRNGState>(new UniformRNGState());
+                    }
+                    state = static_cast<UniformRNGState*>(m_states.at(&node).get());
+                }
+                size_t element_count = shape_size(out0_shape);
+                if (!use_fixed_seed)
+                {
+                    reference::random_uniform<T>(
+                        out[0]->get_data_ptr<T>(), min_val, max_val, element_count, state);
+                }
+                else
+                {
+                    reference::random_uniform_with_fixed_seed<T>(
+                        out[0]->get_data_ptr<T>(), min_val, max_val, element_count, fixed_seed);
+                }
+            };
         }
         case OP_TYPEID::Range:
         {
-            throw unsupported_op("Unsupported op '" + node.description() + "'");
-            break;
+            return unsupported_op_kernel("Unsupported op '" + node.description() + "'");
         }
         case OP_TYPEID::Relu:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::relu<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::ReluBackprop:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu_backprop<T>(args[0]->get_data_ptr<const T>(),
-                                        args[1]->get_data_ptr<const T>(),
-                                        out[0]->get_data_ptr<T>(),
-                                        element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::relu_backprop<T>(args[0]->get_data_ptr<const T>(),
+                                            args[1]->get_data_ptr<const T>(),
+                                            out[0]->get_data_ptr<T>(),
+                                            element_count);
+            };
         }
         case OP_TYPEID::ReplaceSlice:
         {
             const op::ReplaceSlice* slice = static_cast<const op::ReplaceSlice*>(&node);
-            reference::replace_slice<T>(args[0]->get_data_ptr<const T>(),
-                                        args[1]->get_data_ptr<const T>(),
-                                        out[0]->get_data_ptr<T>(),
-                                        node.get_input_shape(1),
-                                        slice->get_lower_bounds(),
-                                        slice->get_upper_bounds(),
-                                        slice->get_strides(),
-                                        node.get_output_shape(0));
-            break;
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out0_shape = node.get_output_shape(0);
+            auto lower_bounds = slice->get_lower_bounds();
+            auto strides = slice->get_strides();
+            auto upper_bounds = slice->get_upper_bounds();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::replace_slice<T>(args[0]->get_data_ptr<const T>(),
+                                            args[1]->get_data_ptr<const T>(),
+                                            out[0]->get_data_ptr<T>(),
+                                            arg1_shape,
+                                            lower_bounds,
+                                            upper_bounds,
+                                            strides,
+                                            out0_shape);
+            };
         }
         case OP_TYPEID::Reshape:
         {
             const op::Reshape* reshape = static_cast<const op::Reshape*>(&node);
-            reference::reshape(args[0]->get_data_ptr<const T>(),
-                               out[0]->get_data_ptr<T>(),
-                               node.get_input_shape(0),
-                               reshape->get_input_order(),
-                               node.get_output_shape(0));
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto input_order = reshape->get_input_order();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::reshape(args[0]->get_data_ptr<const T>(),
+                                   out[0]->get_data_ptr<T>(),
+                                   arg0_shape,
+                                   input_order,
+                                   out0_shape);
+            };
         }
         case OP_TYPEID::Result:
         {
             const op::Result* res = static_cast<const op::Result*>(&node);
-            reference::result(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              shape_size(res->get_shape()));
-            break;
+            auto shape = res->get_shape();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::result(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), shape_size(shape));
+            };
         }
         case OP_TYPEID::Reverse:
         {
             const op::Reverse* reverse = static_cast<const op::Reverse*>(&node);
-            reference::reverse(args[0]->get_data_ptr<const T>(),
-                               out[0]->get_data_ptr<T>(),
-                               node.get_input_shape(0),
-                               node.get_output_shape(0),
-                               reverse->get_reversed_axes());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reversed_axes = reverse->get_reversed_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::reverse(args[0]->get_data_ptr<const T>(),
+                                   out[0]->get_data_ptr<T>(),
+                                   arg0_shape,
+                                   out0_shape,
+                                   reversed_axes);
+            };
         }
         case OP_TYPEID::ReverseSequence:
         {
             const op::ReverseSequence* reverse = static_cast<const op::ReverseSequence*>(&node);
-
-            if (node.get_input_element_type(1) == element::i32)
-            {
-                reference::reverse_sequence<T, int32_t>(args[0]->get_data_ptr<const T>(),
-                                                        out[0]->get_data_ptr<T>(),
-                                                        node.get_input_shape(0),
-                                                        reverse->get_batch_axis(),
-                                                        reverse->get_sequence_axis(),
-                                                        args[1]->get_data_ptr<const int32_t>());
-            }
-            else
-            {
-                throw ngraph_error("only int32 indices are supported");
-            }
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            element::Type arg1_type = node.get_input_element_type(1);
+            auto batch_axis = reverse->get_batch_axis();
+            auto sequence_axis = reverse->get_sequence_axis();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (arg1_type == element::i32)
+                {
+                    reference::reverse_sequence<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                                            out[0]->get_data_ptr<T>(),
+                                                            arg0_shape,
+                                                            batch_axis,
+                                                            sequence_axis,
+                                                            args[1]->get_data_ptr<const int32_t>());
+                }
+                else
+                {
+                    throw ngraph_error("only int32 indices are supported");
+                }
+            };
         }
         case OP_TYPEID::ScatterAdd:
         {
-            if (node.get_input_element_type(1) == element::i64)
-            {
-                reference::scatter_add<T, int64_t>(args[0]->get_data_ptr<T>(),
-                                                   args[1]->get_data_ptr<int64_t>(),
-                                                   args[2]->get_data_ptr<T>(),
-                                                   out[0]->get_data_ptr<T>(),
-                                                   node.get_input_shape(0),
-                                                   node.get_input_shape(1),
-                                                   node.get_input_shape(2),
-                                                   node.get_output_shape(0));
-            }
-            else if (node.get_input_element_type(1) == element::i32)
-            {
-                reference::scatter_add<T, int32_t>(args[0]->get_data_ptr<T>(),
-                                                   args[1]->get_data_ptr<int32_t>(),
-                                                   args[2]->get_data_ptr<T>(),
-                                                   out[0]->get_data_ptr<T>(),
-                                                   node.get_input_shape(0),
-                                                   node.get_input_shape(1),
-                                                   node.get_input_shape(2),
-                                                   node.get_output_shape(0));
-            }
-            else
-            {
-                throw ngraph_error("Unexpected type");
-            }
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape arg2_shape = node.get_input_shape(2);
+            Shape out0_shape = node.get_output_shape(0);
+            element::Type arg1_type = node.get_input_element_type(1);
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (arg1_type == element::i64)
+                {
+                    reference::scatter_add<T, int64_t>(args[0]->get_data_ptr<T>(),
+                                                       args[1]->get_data_ptr<int64_t>(),
+                                                       args[2]->get_data_ptr<T>(),
+                                                       out[0]->get_data_ptr<T>(),
+                                                       arg0_shape,
+                                                       arg1_shape,
+                                                       arg2_shape,
+                                                       out0_shape);
+                }
+                else if (arg1_type == element::i32)
+                {
+                    reference::scatter_add<T, int32_t>(args[0]->get_data_ptr<T>(),
+                                                       args[1]->get_data_ptr<int32_t>(),
+                                                       args[2]->get_data_ptr<T>(),
+                                                       out[0]->get_data_ptr<T>(),
+                                                       arg0_shape,
+                                                       arg1_shape,
+                                                       arg2_shape,
+                                                       out0_shape);
+                }
+                else
+                {
+                    throw ngraph_error("Unexpected type");
+                }
+            };
         }
         case OP_TYPEID::ScatterNDAdd:
         {
-            if (node.get_input_element_type(1) == element::i64)
-            {
-                reference::scatter_nd_add<T, int64_t>(args[0]->get_data_ptr<T>(),
-                                                      args[1]->get_data_ptr<int64_t>(),
-                                                      args[2]->get_data_ptr<T>(),
-                                                      out[0]->get_data_ptr<T>(),
-                                                      node.get_input_shape(0),
-                                                      node.get_input_shape(1),
-                                                      node.get_input_shape(2),
-                                                      node.get_output_shape(0));
-            }
-            else if (node.get_input_element_type(1) == element::i32)
-            {
-                reference::scatter_nd_add<T, int32_t>(args[0]->get_data_ptr<T>(),
-                                                      args[1]->get_data_ptr<int32_t>(),
-                                                      args[2]->get_data_ptr<T>(),
-                                                      out[0]->get_data_ptr<T>(),
-                                                      node.get_input_shape(0),
-                                                      node.get_input_shape(1),
-                                                      node.get_input_shape(2),
-                                                      node.get_output_shape(0));
-            }
-            else
-            {
-                throw ngraph_error("Unexpected type");
-            }
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape arg2_shape = node.get_input_shape(2);
+            Shape out0_shape = node.get_output_shape(0);
+            element::Type arg1_type = node.get_input_element_type(1);
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (arg1_type == element::i64)
+                {
+                    reference::scatter_nd_add<T, int64_t>(args[0]->get_data_ptr<T>(),
+                                                          args[1]->get_data_ptr<int64_t>(),
+                                                          args[2]->get_data_ptr<T>(),
+                                                          out[0]->get_data_ptr<T>(),
+                                                          arg0_shape,
+                                                          arg1_shape,
+                                                          arg2_shape,
+                                                          out0_shape);
+                }
+                else if (arg1_type == element::i32)
+                {
+                    reference::scatter_nd_add<T, int32_t>(args[0]->get_data_ptr<T>(),
+                                                          args[1]->get_data_ptr<int32_t>(),
+                                                          args[2]->get_data_ptr<T>(),
+                                                          out[0]->get_data_ptr<T>(),
+                                                          arg0_shape,
+                                                          arg1_shape,
+                                                          arg2_shape,
+                                                          out0_shape);
+                }
+                else
+                {
+                    throw ngraph_error("Unexpected type");
+                }
+            };
         }
         case OP_TYPEID::Select:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::select<T>(args[0]->get_data_ptr<const char>(),
-                                 args[1]->get_data_ptr<const T>(),
-                                 args[2]->get_data_ptr<const T>(),
-                                 out[0]->get_data_ptr<T>(),
-                                 element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::select<T>(args[0]->get_data_ptr<const char>(),
+                                     args[1]->get_data_ptr<const T>(),
+                                     args[2]->get_data_ptr<const T>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     element_count);
+            };
         }
         case OP_TYPEID::Send:
         {
@@ -1702,175 +2033,214 @@ private:
             size_t memSize = element_count * sizeof(T);
             const auto* op = static_cast<const ngraph::op::Send*>(&node);
             int dest_id = op->get_dest_id();
+            element::Type arg0_type = node.get_input_element_type(0);
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::send<T>(
+                    args[0]->get_data_ptr<const T>(), arg0_type, element_count, dest_id);
 
-            reference::send<T>(args[0]->get_data_ptr<const T>(),
-                               node.get_input_element_type(0),
-                               element_count,
-                               dest_id);
-
-            memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), memSize);
-            break;
+                memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), memSize);
+            };
         }
         case OP_TYPEID::ShapeOf:
         {
-            reference::shape_of(node.get_input_shape(0), out[0]->get_data_ptr<uint64_t>());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            return [=](const HostTensorVector& out, const HostTensorVector& /* args */) {
+                reference::shape_of(arg0_shape, out[0]->get_data_ptr<uint64_t>());
+            };
         }
         case OP_TYPEID::Sigmoid:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::sigmoid<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::SigmoidBackprop:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid_backprop<T>(args[0]->get_data_ptr<const T>(),
-                                           args[1]->get_data_ptr<const T>(),
-                                           out[0]->get_data_ptr<T>(),
-                                           element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::sigmoid_backprop<T>(args[0]->get_data_ptr<const T>(),
+                                               args[1]->get_data_ptr<const T>(),
+                                               out[0]->get_data_ptr<T>(),
+                                               element_count);
+            };
         }
         case OP_TYPEID::Sign:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sign<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::sign<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Sin:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sin<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::sin<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Sinh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sinh<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::sinh<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Slice:
         {
             const op::Slice* slice = static_cast<const op::Slice*>(&node);
-            reference::slice<T>(args[0]->get_data_ptr<const T>(),
-                                out[0]->get_data_ptr<T>(),
-                                node.get_input_shape(0),
-                                slice->get_lower_bounds(),
-                                slice->get_upper_bounds(),
-                                slice->get_strides(),
-                                node.get_output_shape(0));
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto lower_bounds = slice->get_lower_bounds();
+            auto strides = slice->get_strides();
+            auto upper_bounds = slice->get_upper_bounds();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::slice<T>(args[0]->get_data_ptr<const T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    arg0_shape,
+                                    lower_bounds,
+                                    upper_bounds,
+                                    strides,
+                                    out0_shape);
+            };
         }
         case OP_TYPEID::Softmax:
         {
             const op::Softmax* softmax = static_cast<const op::Softmax*>(&node);
-            reference::softmax<T>(args[0]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  node.get_output_shape(0),
-                                  softmax->get_axes());
-            break;
+            Shape out0_shape = node.get_output_shape(0);
+            auto axes = softmax->get_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::softmax<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), out0_shape, axes);
+            };
         }
         case OP_TYPEID::Sqrt:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sqrt<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::sqrt<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
-        case OP_TYPEID::StopGradient: { throw unsupported_op("Unsupported op 'StopGradient'");
+        case OP_TYPEID::StopGradient:
+        {
+            return unsupported_op_kernel("Unsupported op 'StopGradient'");
         }
         case OP_TYPEID::Subtract:
         {
             auto subtract = static_cast<const op::Subtract*>(&node);
-            reference::subtract<T>(args[0]->get_data_ptr<const T>(),
-                                   args[1]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_input_shape(1),
-                                   subtract->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = subtract->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::subtract<T>(args[0]->get_data_ptr<const T>(),
+                                       args[1]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg0_shape,
+                                       arg1_shape,
+                                       autob);
+            };
         }
         case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
-            reference::sum<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              sum->get_reduction_axes());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            auto reduction_axes = sum->get_reduction_axes();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::sum<T>(args[0]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  arg0_shape,
+                                  out0_shape,
+                                  reduction_axes);
+            };
         }
         case OP_TYPEID::Tan:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tan<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::tan<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::Tanh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tanh<T>(
-                args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
-            break;
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::tanh<T>(
+                    args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
+            };
         }
         case OP_TYPEID::TopK:
         {
             const op::TopK* topk = static_cast<const op::TopK*>(&node);
-            if (node.get_output_element_type(0) == element::i64)
-            {
-                reference::topk<T, int64_t>(args[0]->get_data_ptr<const T>(),
-                                            out[0]->get_data_ptr<int64_t>(),
-                                            out[1]->get_data_ptr<T>(),
-                                            node.get_input_shape(0),
-                                            node.get_output_shape(0),
-                                            topk->get_top_k_axis(),
-                                            topk->get_k(),
-                                            topk->get_compute_max(),
-                                            topk->get_sort());
-            }
-            else if (node.get_output_element_type(0) == element::i32)
-            {
-                reference::topk<T, int32_t>(args[0]->get_data_ptr<const T>(),
-                                            out[0]->get_data_ptr<int32_t>(),
-                                            out[1]->get_data_ptr<T>(),
-                                            node.get_input_shape(0),
-                                            node.get_output_shape(0),
-                                            topk->get_top_k_axis(),
-                                            topk->get_k(),
-                                            topk->get_compute_max(),
-                                            topk->get_sort());
-            }
-            else
-            {
-                throw ngraph_error("Unexpected type");
-            }
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape out0_shape = node.get_output_shape(0);
+            element::Type out0_type = node.get_output_element_type(0);
+            auto max = topk->get_compute_max();
+            auto k = topk->get_k();
+            auto sort = topk->get_sort();
+            auto top_k_axis = topk->get_top_k_axis();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                if (out0_type == element::i64)
+                {
+                    reference::topk<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                                out[0]->get_data_ptr<int64_t>(),
+                                                out[1]->get_data_ptr<T>(),
+                                                arg0_shape,
+                                                out0_shape,
+                                                top_k_axis,
+                                                k,
+                                                max,
+                                                sort);
+                }
+                else if (out0_type == element::i32)
+                {
+                    reference::topk<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                                out[0]->get_data_ptr<int32_t>(),
+                                                out[1]->get_data_ptr<T>(),
+                                                arg0_shape,
+                                                out0_shape,
+                                                top_k_axis,
+                                                k,
+                                                max,
+                                                sort);
+                }
+                else
+                {
+                    throw ngraph_error("Unexpected type");
+                }
+            };
         }
         case OP_TYPEID::Xor:
         {
             auto logical_xor = static_cast<const op::Or*>(&node);
-            reference::logical_xor(args[0]->get_data_ptr<const T>(),
-                                   args[1]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_input_shape(1),
-                                   logical_xor->get_autob());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            auto autob = logical_xor->get_autob();
+            return [=](const HostTensorVector& out, const HostTensorVector& args) {
+                reference::logical_xor(args[0]->get_data_ptr<const T>(),
+                                       args[1]->get_data_ptr<const T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg0_shape,
+                                       arg1_shape,
+                                       autob);
+            };
         }
         case OP_TYPEID::DynBroadcast:
         case OP_TYPEID::Transpose:
         case OP_TYPEID::DynPad:
         case OP_TYPEID::Tile:
         case OP_TYPEID::DynReplaceSlice:
-            throw unsupported_op("Unsupported op '" + node.description() + "'");
+            return unsupported_op_kernel("Unsupported op '" + node.description() + "'");
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
 #pragma GCC diagnostic pop
 #endif
         }
+        return unsupported_op_kernel("Unsupported op '" + node.description() + "'");
     }
 };
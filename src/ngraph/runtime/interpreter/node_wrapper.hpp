@@ -54,7 +54,7 @@ class ngraph::runtime::interpreter::NodeWrapper
 public:
     NodeWrapper(const std::shared_ptr<const ngraph::Node>& node);
 
-    std::shared_ptr<const Node> get_node() const { return m_node; }
+    const std::shared_ptr<const Node>& get_node() const { return m_node; }
     ngraph::runtime::interpreter::OP_TYPEID get_typeid() const { return m_typeid; }
 private:
     std::shared_ptr<const ngraph::Node> m_node;
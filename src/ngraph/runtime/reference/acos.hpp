@@ -19,6 +19,8 @@
 #include <cmath>
 #include <cstddef>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -28,10 +30,12 @@ namespace ngraph
             template <typename T>
             void acos(const T* arg, T* out, size_t count)
             {
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = std::acos(arg[i]);
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = std::acos(arg[i]);
+                    }
+                });
             }
         }
     }
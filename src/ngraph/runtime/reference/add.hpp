@@ -21,6 +21,7 @@
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -32,10 +33,12 @@ namespace ngraph
             template <typename T>
             void add(const T* arg0, const T* arg1, T* out, size_t count)
             {
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = arg0[i] + arg1[i];
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = arg0[i] + arg1[i];
+                    }
+                });
             }
 
             template <typename T>
@@ -18,7 +18,7 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -28,30 +28,14 @@ namespace ngraph
         namespace reference
         {
             template <typename T, typename U>
-            void argmax(
-                const T* arg, U* out, const Shape& in_shape, const Shape& out_shape, size_t axis)
+            void argmax(const T* arg,
+                        U* out,
+                        const Shape& in_shape,
+                        const Shape& /* out_shape */,
+                        size_t axis)
             {
-                // take the first elements (i.e. 0 indices) in out_shape - axis as maximums
-                memset(out, 0, shape_size(out_shape) * sizeof(U));
-
-                AxisVector av{axis};
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, av);
-                    CoordinateTransform output_transform(out_shape);
-
-                    auto min_index = static_cast<size_t>(out[output_transform.index(output_coord)]);
-                    auto min_coord = input_coord;
-                    min_coord[axis] = min_index;
-                    if (arg[input_transform.index(input_coord)] >
-                        arg[input_transform.index(min_coord)])
-                    {
-                        out[output_transform.index(output_coord)] =
-                            static_cast<U>(input_coord[axis]);
-                    }
-                }
+                // ties go to the first (i.e. lowest) index along axis
+                arg_reduction(arg, out, in_shape, axis, [](T x, T best) { return x > best; });
             }
         }
     }
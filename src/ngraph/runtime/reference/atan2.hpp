@@ -19,6 +19,8 @@
 #include <cmath>
 #include <cstddef>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -28,10 +30,12 @@ namespace ngraph
             template <typename X, typename Y, typename Z>
             void atan2(const X* py, const Y* px, Z* pout, size_t count)
             {
-                for (size_t i = 0; i < count; i++)
-                {
-                    *pout++ = static_cast<Z>(std::atan2(*py++, *px++));
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        *pout++ = static_cast<Z>(std::atan2(*py++, *px++));
+                    }
+                });
             }
         }
     }
@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -28,6 +31,140 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief The output shape of a broadcasting binary op and, for each axis, the
+            /// distance between neighbouring elements of each input along it. Inputs broadcast
+            /// along an axis have a stride of zero there.
+            struct BroadcastStrides
+            {
+                Shape m_shape;
+                Strides m_arg0_strides;
+                Strides m_arg1_strides;
+            };
+
+            /// \brief Computes the strides for inputs of arg0_shape and arg1_shape padded with
+            /// ones to the same rank. Axes of size one are dropped and neighbouring axes that
+            /// both inputs walk in the same way are merged, so [N,C,H,W] + [C,1,1] becomes
+            /// [N,C,H*W] with strides [C*H*W,H*W,1] and [0,1,0].
+            inline BroadcastStrides get_broadcast_strides(const Shape& arg0_shape,
+                                                          const Shape& arg1_shape)
+            {
+                BroadcastStrides result;
+                result.m_arg0_strides = row_major_strides(arg0_shape);
+                result.m_arg1_strides = row_major_strides(arg1_shape);
+                for (size_t axis = 0; axis < arg0_shape.size(); axis++)
+                {
+                    if (arg0_shape[axis] == 1)
+                    {
+                        result.m_shape.push_back(arg1_shape[axis]);
+                        result.m_arg0_strides[axis] = 0;
+                    }
+                    else
+                    {
+                        result.m_shape.push_back(arg0_shape[axis]);
+                    }
+                    if (arg1_shape[axis] == 1)
+                    {
+                        result.m_arg1_strides[axis] = 0;
+                    }
+                }
+                merge_strided_axes(result.m_shape,
+                                   std::array<Strides*, 2>{
+                                       {&result.m_arg0_strides, &result.m_arg1_strides}});
+                return result;
+            }
+
+            // Applies elementwise_functor along one row of the innermost axis. After merging,
+            // each input either walks the row contiguously or repeats a single element, and
+            // each combination gets a plain loop the compiler can vectorize.
+            template <typename T, typename U, typename Functor>
+            void broadcast_binop_row(const T* arg0,
+                                     size_t stride0,
+                                     const T* arg1,
+                                     size_t stride1,
+                                     U* out,
+                                     size_t count,
+                                     Functor& elementwise_functor)
+            {
+                if (stride0 == 1 && stride1 == 1)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = elementwise_functor(arg0[i], arg1[i]);
+                    }
+                }
+                else if (stride0 == 1 && stride1 == 0)
+                {
+                    const T y = *arg1;
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = elementwise_functor(arg0[i], y);
+                    }
+                }
+                else if (stride0 == 0 && stride1 == 1)
+                {
+                    const T x = *arg0;
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = elementwise_functor(x, arg1[i]);
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = elementwise_functor(arg0[i * stride0], arg1[i * stride1]);
+                    }
+                }
+            }
+
+            /// \brief Computes out = elementwise_functor(arg0, arg1) over the row-major output
+            /// described by strides. The output is split into contiguous ranges on the intra-op
+            /// thread pool; each range works out the input offsets of its first element once and
+            /// then steps them along with the output.
+            template <typename T, typename U, typename Functor>
+            void broadcast_binop(const T* arg0,
+                                 const T* arg1,
+                                 U* out,
+                                 const BroadcastStrides& strides,
+                                 Functor elementwise_functor)
+            {
+                const Shape& shape = strides.m_shape;
+                const Strides& strides0 = strides.m_arg0_strides;
+                const Strides& strides1 = strides.m_arg1_strides;
+                size_t size = shape_size(shape);
+                if (size == 0)
+                {
+                    return;
+                }
+                if (shape.empty())
+                {
+                    out[0] = elementwise_functor(arg0[0], arg1[0]);
+                    return;
+                }
+                size_t inner_axis = shape.size() - 1;
+                size_t row_size = shape[inner_axis];
+
+                parallel_for(size, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    StridedCounter<Strides, 2> row(
+                        shape, {{&strides0, &strides1}}, inner_axis, begin / row_size);
+                    size_t column = begin % row_size;
+                    for (size_t i = begin; i < end;)
+                    {
+                        size_t count = std::min(row_size - column, end - i);
+                        broadcast_binop_row(arg0 + row[0] + column * strides0[inner_axis],
+                                            strides0[inner_axis],
+                                            arg1 + row[1] + column * strides1[inner_axis],
+                                            strides1[inner_axis],
+                                            out + i,
+                                            count,
+                                            elementwise_functor);
+                        i += count;
+                        column = 0;
+                        ++row;
+                    }
+                });
+            }
+
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
             ///
             /// \tparam T Element type of the input tensors.
@@ -45,6 +182,7 @@ namespace ngraph
             /// \param elementwise_functor Functor implementing the elementwise operation to be
             ///                            applied across the input tensors. Must accept two
             ///                            arguments of type T, and return a value of type U.
+            ///                            It may be called from several threads at once.
             template <typename T, typename U, typename Functor>
             void autobroadcast_binop(const T* arg0,
                                      const T* arg1,
@@ -54,31 +192,33 @@ namespace ngraph
                                      const op::AutoBroadcastSpec& broadcast_spec,
                                      Functor elementwise_functor)
             {
+                // An axis of size zero broadcasts to zero elements, so there is nothing to write
+                if (shape_size(arg0_shape) == 0 || shape_size(arg1_shape) == 0)
+                {
+                    return;
+                }
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for(shape_size(arg0_shape),
+                                 parallel_elementwise_grain,
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t i = begin; i < end; i++)
+                                     {
+                                         out[i] = elementwise_functor(arg0[i], arg1[i]);
+                                     }
+                                 });
                     break;
                 case op::AutoBroadcastType::NUMPY:
-                    // We'll be using CoordinateTransform to handle the broadcasting. The general
-                    // procedure is as follows:
-                    //
-                    // (1) Left pad the shorter of the two shapes with ones.
-                    // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast both args to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     2.
+                    // Left pad the shorter of the two shapes with ones; the output takes the
+                    // larger size on every axis.
                     //
                     // Example:
                     //
-                    //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
-                    // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
+                    //    Input shape->Padded shape->Strides
+                    //    -----------  ------------  -------
+                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 2, 1, 0]
+                    // b: [    1, 6]   [ 1, 1, 6]    [ 0, 0, 1]
                     //                   |  |  |
                     //                   v  v  v
                     //                 Output shape
@@ -98,71 +238,28 @@ namespace ngraph
                             arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
                         }
 
-                        Shape arg0_squeezed_shape;
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg0_squeezed_axes;
-                        AxisSet arg1_squeezed_axes;
-                        Shape output_shape;
-
-                        for (size_t i = 0; i < arg0_padded_shape.size(); i++)
-                        {
-                            if (arg0_padded_shape[i] == 1)
-                            {
-                                arg0_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                            }
-
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-
-                            output_shape.push_back(arg0_padded_shape[i] == 1
-                                                       ? arg1_padded_shape[i]
-                                                       : arg0_padded_shape[i]);
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(output_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes);
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
+                        broadcast_binop(arg0,
+                                        arg1,
+                                        out,
+                                        get_broadcast_strides(arg0_padded_shape,
+                                                              arg1_padded_shape),
+                                        elementwise_functor);
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
-                    // We'll be using CoordinateTransform to handle the broadcasting. No need to
-                    // process arg0 and output shape will be the same as arg0. We need to process
-                    // arg1 and the general procedure is as follows:
+                    // The output shape is the shape of arg0. arg1 is padded to the rank of arg0
+                    // as follows:
                     //
                     // (1) Trim trailing ones from arg1 shape.
                     // (2) Left and right pad arg1 to match arg0 shape. Axis is the index start
                     //     to align between arg0 and arg1.
-                    // (3) Squeeze (remove ones from) arg1 shape, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast arg1 to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     23.
                     //
                     // Example:
                     //
-                    //    Input shape->   Padded shape->   Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [ 3, 4, 5, 6]
-                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [    4, 5   ]     {0,3}
+                    //    Input shape->   Padded shape->   Strides
+                    //    -----------  ------------  -------
+                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [120, 30, 6, 1]
+                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [  0,  5, 1, 0]
                     //                      |  |  |
                     //                      v  v  v
                     //                     Output shape
@@ -192,32 +289,11 @@ namespace ngraph
                             arg1_padded_shape.insert(arg1_padded_shape.end(), 1);
                         }
 
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg1_squeezed_axes;
-
-                        for (size_t i = 0; i < arg0_shape.size(); i++)
-                        {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(arg0_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(output_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
+                        broadcast_binop(arg0,
+                                        arg1,
+                                        out,
+                                        get_broadcast_strides(arg0_shape, arg1_padded_shape),
+                                        elementwise_functor);
                     }
                 }
             }
@@ -24,6 +24,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_walk.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -50,10 +51,7 @@ namespace ngraph
                     out[out_transform.index(out_coord)] = 0;
                 }
 
-                CoordinateTransform delta_transform(delta_shape);
-
-                for (const Coordinate& delta_coord : delta_transform)
-                {
+                parallel_plane_walk(delta_shape, [&](const Coordinate& delta_coord, size_t index) {
                     size_t img_index = delta_coord[0];
                     size_t channel = delta_coord[1];
 
@@ -114,11 +112,10 @@ namespace ngraph
                         if (source_window_transform.has_source_coordinate(source_window_coord))
                         {
                             size_t out_index = source_window_transform.index(source_window_coord);
-                            out[out_index] +=
-                                delta[delta_transform.index(delta_coord)] / num_elements_in_window;
+                            out[out_index] += delta[index] / num_elements_in_window;
                         }
                     }
-                }
+                });
             }
 
             template <typename T>
@@ -132,13 +129,8 @@ namespace ngraph
                           const Shape& padding_above,
                           bool include_padding_in_avg_computation)
             {
-                auto old_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
                 // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& out_coord : output_transform)
-                {
+                parallel_plane_walk(out_shape, [&](const Coordinate& out_coord, size_t out_index) {
                     // Our output coordinate O will have the form:
                     //
                     //   (N,chan,i_1,...,i_n)
@@ -237,15 +229,18 @@ namespace ngraph
 
                     if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value)
                     {
-                        out[output_transform.index(out_coord)] =
+                        // The rounding mode is per thread, so it is set on the one running this
+                        auto old_mode = std::fegetround();
+                        std::fesetround(FE_TONEAREST);
+                        out[out_index] =
                             static_cast<T>(std::nearbyint(static_cast<float>(result) / n_elements));
+                        std::fesetround(old_mode);
                     }
                     else
                     {
-                        out[output_transform.index(out_coord)] = result / n_elements;
+                        out[out_index] = result / n_elements;
                     }
-                    std::fesetround(old_mode);
-                }
+                });
             }
         }
     }
@@ -18,7 +18,9 @@
 
 #include <cmath>
 
+#include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_walk.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -34,16 +36,18 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                CoordinateTransform input_transform(in_shape);
-                CoordinateTransform output_transform(out_shape);
+                NGRAPH_CHECK(shape_size(in_shape) ==
+                             shape_size(reduce(out_shape, broadcast_axes)));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    Coordinate input_coord = reduce(output_coord, broadcast_axes);
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-                }
+                // Walk the output in row-major order; the input index does not move along the
+                // broadcast axes.
+                parallel_strided_walk(out_shape,
+                                      row_major_strides(out_shape),
+                                      reduction_strides(out_shape, broadcast_axes),
+                                      0,
+                                      [&](size_t output_index, size_t input_index) {
+                                          out[output_index] = arg[input_index];
+                                      });
             }
         }
     }
@@ -18,6 +18,8 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -27,19 +29,23 @@ namespace ngraph
             template <typename TI, typename TO>
             void convert(const TI* arg, TO* out, size_t count)
             {
-                for (size_t i = 0; i < count; ++i)
-                {
-                    out[i] = static_cast<TO>(arg[i]);
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = static_cast<TO>(arg[i]);
+                    }
+                });
             }
 
             template <typename T>
             void convert_to_bool(const T* arg, char* out, size_t count)
             {
-                for (size_t i = 0; i < count; ++i)
-                {
-                    out[i] = static_cast<char>(static_cast<bool>(arg[i]));
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = static_cast<char>(static_cast<bool>(arg[i]));
+                    }
+                });
             }
         }
     }
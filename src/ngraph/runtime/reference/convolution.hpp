@@ -16,13 +16,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
+#include <cstdlib>
 #include <functional>
+#include <type_traits>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -49,6 +55,10 @@ namespace ngraph
                 using type = long double;
             };
 
+            // Direct convolution: walks every output coordinate and the padded, dilated input
+            // window under it. This is the original kernel, kept as the accuracy baseline for
+            // the lowered algorithms below.
+            //
             // in: NC_I...
             // filter: C_OC_I...
             // out: NC_O...
@@ -56,29 +66,29 @@ namespace ngraph
                       typename FILTER,
                       typename OUTPUT,
                       typename ACCUMULATION = typename widen<OUTPUT>::type>
-            void general_convolution(const INPUT* in,
-                                     const FILTER* filter,
-                                     OUTPUT* out,
-                                     const Shape& in_shape,
-                                     const Shape& filter_shape,
-                                     const Shape& out_shape,
-                                     const Strides& stride,
-                                     const Strides& filter_dilation,
-                                     const CoordinateDiff& in_pad_below,
-                                     const CoordinateDiff& in_pad_above,
-                                     const Strides& in_dilation,
-                                     size_t in_batch_axis,
-                                     size_t in_channel_axis,
-                                     size_t filter_out_channel_axis,
-                                     size_t filter_in_channel_axis,
-                                     size_t out_batch_axis,
-                                     size_t out_channel_axis,
-                                     const float* input_scale = nullptr,
-                                     const INPUT* input_zero_point = nullptr,
-                                     const float* filter_scale = nullptr,
-                                     const FILTER* filter_zero_point = nullptr,
-                                     const float* output_scale = nullptr,
-                                     const OUTPUT* output_zero_point = nullptr)
+            void general_convolution_direct(const INPUT* in,
+                                            const FILTER* filter,
+                                            OUTPUT* out,
+                                            const Shape& in_shape,
+                                            const Shape& filter_shape,
+                                            const Shape& out_shape,
+                                            const Strides& stride,
+                                            const Strides& filter_dilation,
+                                            const CoordinateDiff& in_pad_below,
+                                            const CoordinateDiff& in_pad_above,
+                                            const Strides& in_dilation,
+                                            size_t in_batch_axis,
+                                            size_t in_channel_axis,
+                                            size_t filter_out_channel_axis,
+                                            size_t filter_in_channel_axis,
+                                            size_t out_batch_axis,
+                                            size_t out_channel_axis,
+                                            const float* input_scale = nullptr,
+                                            const INPUT* input_zero_point = nullptr,
+                                            const float* filter_scale = nullptr,
+                                            const FILTER* filter_zero_point = nullptr,
+                                            const float* output_scale = nullptr,
+                                            const OUTPUT* output_zero_point = nullptr)
             {
                 bool is_quantized = false;
                 if (input_scale && input_zero_point && filter_scale && filter_zero_point &&
@@ -264,6 +274,482 @@ namespace ngraph
                 std::fesetround(old_mode);
             }
 
+            // Convolution lowered onto blocked_matmul. For every batch the filter is packed as an
+            // [out_channels x (filter_taps * in_channels)] matrix and a block of output positions
+            // is unrolled into the matching im2col matrix, with positions that fall into padding
+            // or an input dilation gap filled with the input zero point. The reduction runs over
+            // taps and channels in the same order as general_convolution_direct.
+            template <typename INPUT,
+                      typename FILTER,
+                      typename OUTPUT,
+                      typename ACCUMULATION = typename widen<OUTPUT>::type>
+            void general_convolution_im2col(const INPUT* in,
+                                            const FILTER* filter,
+                                            OUTPUT* out,
+                                            const Shape& in_shape,
+                                            const Shape& filter_shape,
+                                            const Shape& out_shape,
+                                            const Strides& stride,
+                                            const Strides& filter_dilation,
+                                            const CoordinateDiff& in_pad_below,
+                                            const CoordinateDiff& in_pad_above,
+                                            const Strides& in_dilation,
+                                            size_t in_batch_axis,
+                                            size_t in_channel_axis,
+                                            size_t filter_out_channel_axis,
+                                            size_t filter_in_channel_axis,
+                                            size_t out_batch_axis,
+                                            size_t out_channel_axis,
+                                            const float* input_scale = nullptr,
+                                            const INPUT* input_zero_point = nullptr,
+                                            const float* filter_scale = nullptr,
+                                            const FILTER* filter_zero_point = nullptr,
+                                            const float* output_scale = nullptr,
+                                            const OUTPUT* output_zero_point = nullptr)
+            {
+                bool is_quantized = false;
+                if (input_scale && input_zero_point && filter_scale && filter_zero_point &&
+                    output_scale && output_zero_point)
+                {
+                    is_quantized = true;
+                }
+
+                auto old_mode = std::fegetround();
+                std::fesetround(FE_TONEAREST);
+
+                size_t n_spatial_dimensions = in_shape.size() - 2;
+                size_t batch_size = in_shape[in_batch_axis];
+                size_t n_in_channels = in_shape[in_channel_axis];
+                size_t n_out_channels = out_shape[out_channel_axis];
+
+                Shape filter_spatial_shape(filter_shape.begin() + 2, filter_shape.end());
+                Shape out_spatial_shape(out_shape.begin() + 2, out_shape.end());
+                size_t n_filter_taps = shape_size(filter_spatial_shape);
+                size_t n_out_positions = shape_size(out_spatial_shape);
+                size_t k_size = n_filter_taps * n_in_channels;
+
+                Strides in_strides = row_major_strides(in_shape);
+                Strides filter_strides = row_major_strides(filter_shape);
+                Strides out_strides = row_major_strides(out_shape);
+
+                // Pack the filter; column k = tap * n_in_channels + in_channel.
+                std::vector<Coordinate> taps;
+                for (const Coordinate& tap : CoordinateTransform(filter_spatial_shape))
+                {
+                    taps.push_back(tap);
+                }
+                std::vector<FILTER> packed_filter(n_out_channels * k_size);
+                for (size_t out_channel = 0; out_channel < n_out_channels; out_channel++)
+                {
+                    for (size_t t = 0; t < n_filter_taps; t++)
+                    {
+                        size_t filter_index = out_channel * filter_strides[filter_out_channel_axis];
+                        for (size_t i = 0; i < n_spatial_dimensions; i++)
+                        {
+                            filter_index += taps[t][i] * filter_strides[i + 2];
+                        }
+                        for (size_t in_channel = 0; in_channel < n_in_channels; in_channel++)
+                        {
+                            packed_filter[out_channel * k_size + t * n_in_channels + in_channel] =
+                                filter[filter_index +
+                                       in_channel * filter_strides[filter_in_channel_axis]];
+                        }
+                    }
+                }
+
+                ACCUMULATION filter_zp = 0;
+                ACCUMULATION input_zp = 0;
+                INPUT pad_value = 0;
+                float scale = 1;
+                if (is_quantized)
+                {
+                    filter_zp = static_cast<ACCUMULATION>(*filter_zero_point);
+                    input_zp = static_cast<ACCUMULATION>(*input_zero_point);
+                    pad_value = *input_zero_point;
+                    scale = *input_scale * *filter_scale / *output_scale;
+                }
+
+                size_t block_size = std::min(dot_block_n, n_out_positions);
+                size_t n_blocks =
+                    block_size == 0 ? 0 : (n_out_positions + block_size - 1) / block_size;
+
+                // Every block of output positions of every batch is unrolled and multiplied on
+                // its own, so the blocks are spread over the intra-op thread pool.
+                size_t grain = parallel_grain(n_out_channels * k_size * block_size);
+                parallel_for(batch_size * n_blocks, grain, [&](size_t begin, size_t end) {
+                    std::vector<INPUT> columns(k_size * block_size);
+                    Coordinate out_position(n_spatial_dimensions);
+                    for (size_t block = begin; block < end; block++)
+                    {
+                        size_t batch_index = block / n_blocks;
+                        size_t j0 = (block % n_blocks) * block_size;
+                        size_t jb = std::min(block_size, n_out_positions - j0);
+
+                        size_t position = j0;
+                        for (size_t i = n_spatial_dimensions; i-- > 0;)
+                        {
+                            out_position[i] = position % out_spatial_shape[i];
+                            position /= out_spatial_shape[i];
+                        }
+
+                        for (size_t j = 0; j < jb; j++)
+                        {
+                            for (size_t t = 0; t < n_filter_taps; t++)
+                            {
+                                // Map the tap under this output position back into the input.
+                                bool in_padding = false;
+                                size_t in_index = batch_index * in_strides[in_batch_axis];
+                                for (size_t i = 0; i < n_spatial_dimensions && !in_padding; i++)
+                                {
+                                    std::ptrdiff_t pos =
+                                        static_cast<std::ptrdiff_t>(out_position[i] * stride[i] +
+                                                                    taps[t][i] *
+                                                                        filter_dilation[i]) -
+                                        in_pad_below[i];
+                                    if (pos < 0 || pos % in_dilation[i] != 0)
+                                    {
+                                        in_padding = true;
+                                        break;
+                                    }
+                                    size_t in_pos = pos / in_dilation[i];
+                                    if (in_pos >= in_shape[i + 2])
+                                    {
+                                        in_padding = true;
+                                        break;
+                                    }
+                                    in_index += in_pos * in_strides[i + 2];
+                                }
+
+                                INPUT* column = columns.data() + t * n_in_channels * jb + j;
+                                for (size_t in_channel = 0; in_channel < n_in_channels;
+                                     in_channel++)
+                                {
+                                    column[in_channel * jb] =
+                                        in_padding
+                                            ? pad_value
+                                            : in[in_index +
+                                                 in_channel * in_strides[in_channel_axis]];
+                                }
+                            }
+
+                            // Advance to the next output position in row-major order.
+                            for (size_t i = n_spatial_dimensions; i-- > 0;)
+                            {
+                                if (++out_position[i] < out_spatial_shape[i])
+                                {
+                                    break;
+                                }
+                                out_position[i] = 0;
+                            }
+                        }
+
+                        size_t out_base = batch_index * out_strides[out_batch_axis] + j0;
+                        blocked_matmul(
+                            packed_filter.data(),
+                            columns.data(),
+                            n_out_channels,
+                            k_size,
+                            jb,
+                            filter_zp,
+                            input_zp,
+                            [&](size_t index, ACCUMULATION sum) {
+                                size_t out_index = out_base +
+                                                   (index / jb) * out_strides[out_channel_axis] +
+                                                   index % jb;
+                                if (is_quantized)
+                                {
+                                    out[out_index] = static_cast<OUTPUT>(std::round(
+                                                         static_cast<float>(sum) * scale)) +
+                                                     *output_zero_point;
+                                }
+                                else
+                                {
+                                    out[out_index] = static_cast<OUTPUT>(sum);
+                                }
+                            });
+                    }
+                });
+                std::fesetround(old_mode);
+            }
+
+            // Winograd F(2x2, 3x3) for NCHW convolution with a 3x3 filter, unit strides and no
+            // dilation. Every 4x4 input tile produces a 2x2 output tile with 16 instead of 36
+            // multiplications per channel pair. The transforms are evaluated in ACCUMULATION,
+            // which only makes sense for floating point types.
+            template <typename INPUT,
+                      typename FILTER,
+                      typename OUTPUT,
+                      typename ACCUMULATION = typename widen<OUTPUT>::type>
+            void convolution_winograd_3x3(const INPUT* in,
+                                          const FILTER* filter,
+                                          OUTPUT* out,
+                                          const Shape& in_shape,
+                                          const Shape& filter_shape,
+                                          const Shape& out_shape,
+                                          const CoordinateDiff& in_pad_below)
+            {
+                const size_t batch_size = in_shape[0];
+                const size_t n_in_channels = in_shape[1];
+                const size_t in_height = in_shape[2];
+                const size_t in_width = in_shape[3];
+                const size_t n_out_channels = filter_shape[0];
+                const size_t out_height = out_shape[2];
+                const size_t out_width = out_shape[3];
+                const std::ptrdiff_t pad_top = in_pad_below[0];
+                const std::ptrdiff_t pad_left = in_pad_below[1];
+                const ACCUMULATION half = ACCUMULATION(1) / ACCUMULATION(2);
+
+                // U = G g G^T for every (out_channel, in_channel) pair
+                std::vector<ACCUMULATION> u(n_out_channels * n_in_channels * 16);
+                for (size_t oc_ic = 0; oc_ic < n_out_channels * n_in_channels; oc_ic++)
+                {
+                    const FILTER* g = filter + oc_ic * 9;
+                    ACCUMULATION gg[4][3];
+                    for (size_t c = 0; c < 3; c++)
+                    {
+                        ACCUMULATION g0 = static_cast<ACCUMULATION>(g[c]);
+                        ACCUMULATION g1 = static_cast<ACCUMULATION>(g[3 + c]);
+                        ACCUMULATION g2 = static_cast<ACCUMULATION>(g[6 + c]);
+                        gg[0][c] = g0;
+                        gg[1][c] = (g0 + g1 + g2) * half;
+                        gg[2][c] = (g0 - g1 + g2) * half;
+                        gg[3][c] = g2;
+                    }
+                    ACCUMULATION* uu = u.data() + oc_ic * 16;
+                    for (size_t r = 0; r < 4; r++)
+                    {
+                        uu[r * 4 + 0] = gg[r][0];
+                        uu[r * 4 + 1] = (gg[r][0] + gg[r][1] + gg[r][2]) * half;
+                        uu[r * 4 + 2] = (gg[r][0] - gg[r][1] + gg[r][2]) * half;
+                        uu[r * 4 + 3] = gg[r][2];
+                    }
+                }
+
+                const size_t tiles_h = (out_height + 1) / 2;
+                const size_t tiles_w = (out_width + 1) / 2;
+                size_t grain = parallel_grain(tiles_w * 16 * n_in_channels * n_out_channels);
+
+                // Rows of output tiles are independent and distributed over the intra-op pool.
+                parallel_for(batch_size * tiles_h, grain, [&](size_t begin, size_t end) {
+                    std::vector<ACCUMULATION> v(n_in_channels * 16);
+                    ACCUMULATION m[16];
+                    for (size_t tile_row = begin; tile_row < end; tile_row++)
+                    {
+                        size_t batch_index = tile_row / tiles_h;
+                        size_t th = tile_row % tiles_h;
+                        for (size_t tw = 0; tw < tiles_w; tw++)
+                        {
+                            std::ptrdiff_t row0 = static_cast<std::ptrdiff_t>(th * 2) - pad_top;
+                            std::ptrdiff_t col0 = static_cast<std::ptrdiff_t>(tw * 2) - pad_left;
+
+                            // V = B^T d B for every input channel
+                            for (size_t in_channel = 0; in_channel < n_in_channels; in_channel++)
+                            {
+                                const INPUT* plane =
+                                    in + (batch_index * n_in_channels + in_channel) * in_height *
+                                             in_width;
+                                ACCUMULATION d[4][4];
+                                for (size_t r = 0; r < 4; r++)
+                                {
+                                    std::ptrdiff_t row = row0 + static_cast<std::ptrdiff_t>(r);
+                                    for (size_t c = 0; c < 4; c++)
+                                    {
+                                        std::ptrdiff_t col = col0 + static_cast<std::ptrdiff_t>(c);
+                                        bool inside =
+                                            row >= 0 &&
+                                            row < static_cast<std::ptrdiff_t>(in_height) &&
+                                            col >= 0 && col < static_cast<std::ptrdiff_t>(in_width);
+                                        d[r][c] = inside ? static_cast<ACCUMULATION>(
+                                                               plane[row * in_width + col])
+                                                         : ACCUMULATION(0);
+                                    }
+                                }
+                                ACCUMULATION bd[4][4];
+                                for (size_t c = 0; c < 4; c++)
+                                {
+                                    bd[0][c] = d[0][c] - d[2][c];
+                                    bd[1][c] = d[1][c] + d[2][c];
+                                    bd[2][c] = d[2][c] - d[1][c];
+                                    bd[3][c] = d[1][c] - d[3][c];
+                                }
+                                ACCUMULATION* vv = v.data() + in_channel * 16;
+                                for (size_t r = 0; r < 4; r++)
+                                {
+                                    vv[r * 4 + 0] = bd[r][0] - bd[r][2];
+                                    vv[r * 4 + 1] = bd[r][1] + bd[r][2];
+                                    vv[r * 4 + 2] = bd[r][2] - bd[r][1];
+                                    vv[r * 4 + 3] = bd[r][1] - bd[r][3];
+                                }
+                            }
+
+                            for (size_t out_channel = 0; out_channel < n_out_channels;
+                                 out_channel++)
+                            {
+                                std::fill(m, m + 16, ACCUMULATION(0));
+                                const ACCUMULATION* uu =
+                                    u.data() + out_channel * n_in_channels * 16;
+                                for (size_t in_channel = 0; in_channel < n_in_channels;
+                                     in_channel++)
+                                {
+                                    const ACCUMULATION* vv = v.data() + in_channel * 16;
+                                    const ACCUMULATION* uc = uu + in_channel * 16;
+                                    for (size_t e = 0; e < 16; e++)
+                                    {
+                                        m[e] += uc[e] * vv[e];
+                                    }
+                                }
+
+                                // Y = A^T M A
+                                ACCUMULATION am[2][4];
+                                for (size_t c = 0; c < 4; c++)
+                                {
+                                    am[0][c] = m[c] + m[4 + c] + m[8 + c];
+                                    am[1][c] = m[4 + c] - m[8 + c] - m[12 + c];
+                                }
+                                OUTPUT* plane =
+                                    out + (batch_index * n_out_channels + out_channel) *
+                                              out_height * out_width;
+                                for (size_t r = 0; r < 2; r++)
+                                {
+                                    size_t row = th * 2 + r;
+                                    if (row >= out_height)
+                                    {
+                                        break;
+                                    }
+                                    ACCUMULATION y0 = am[r][0] + am[r][1] + am[r][2];
+                                    ACCUMULATION y1 = am[r][1] - am[r][2] - am[r][3];
+                                    plane[row * out_width + tw * 2] = static_cast<OUTPUT>(y0);
+                                    if (tw * 2 + 1 < out_width)
+                                    {
+                                        plane[row * out_width + tw * 2 + 1] =
+                                            static_cast<OUTPUT>(y1);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                });
+            }
+
+            // Picks a convolution algorithm. Winograd is used for unquantized floating point 2D
+            // convolutions with a 3x3 filter, unit strides and no dilation in the forward
+            // layout; everything else is lowered through im2col. Setting
+            // NGRAPH_REFERENCE_CONVOLUTION_DIRECT selects general_convolution_direct instead,
+            // which is useful for accuracy comparisons.
+            template <typename INPUT,
+                      typename FILTER,
+                      typename OUTPUT,
+                      typename ACCUMULATION = typename widen<OUTPUT>::type>
+            void general_convolution(const INPUT* in,
+                                     const FILTER* filter,
+                                     OUTPUT* out,
+                                     const Shape& in_shape,
+                                     const Shape& filter_shape,
+                                     const Shape& out_shape,
+                                     const Strides& stride,
+                                     const Strides& filter_dilation,
+                                     const CoordinateDiff& in_pad_below,
+                                     const CoordinateDiff& in_pad_above,
+                                     const Strides& in_dilation,
+                                     size_t in_batch_axis,
+                                     size_t in_channel_axis,
+                                     size_t filter_out_channel_axis,
+                                     size_t filter_in_channel_axis,
+                                     size_t out_batch_axis,
+                                     size_t out_channel_axis,
+                                     const float* input_scale = nullptr,
+                                     const INPUT* input_zero_point = nullptr,
+                                     const float* filter_scale = nullptr,
+                                     const FILTER* filter_zero_point = nullptr,
+                                     const float* output_scale = nullptr,
+                                     const OUTPUT* output_zero_point = nullptr)
+            {
+                static const bool use_direct =
+                    std::getenv("NGRAPH_REFERENCE_CONVOLUTION_DIRECT") != nullptr;
+                if (use_direct)
+                {
+                    general_convolution_direct<INPUT, FILTER, OUTPUT, ACCUMULATION>(
+                        in,
+                        filter,
+                        out,
+                        in_shape,
+                        filter_shape,
+                        out_shape,
+                        stride,
+                        filter_dilation,
+                        in_pad_below,
+                        in_pad_above,
+                        in_dilation,
+                        in_batch_axis,
+                        in_channel_axis,
+                        filter_out_channel_axis,
+                        filter_in_channel_axis,
+                        out_batch_axis,
+                        out_channel_axis,
+                        input_scale,
+                        input_zero_point,
+                        filter_scale,
+                        filter_zero_point,
+                        output_scale,
+                        output_zero_point);
+                    return;
+                }
+
+                bool is_quantized = input_scale && input_zero_point && filter_scale &&
+                                    filter_zero_point && output_scale && output_zero_point;
+                auto is_unit = [](const Strides& strides) {
+                    for (size_t s : strides)
+                    {
+                        if (s != 1)
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                };
+                bool use_winograd =
+                    std::is_floating_point<ACCUMULATION>::value && !is_quantized &&
+                    in_shape.size() == 4 && filter_shape[2] == 3 && filter_shape[3] == 3 &&
+                    in_batch_axis == 0 && in_channel_axis == 1 && filter_out_channel_axis == 0 &&
+                    filter_in_channel_axis == 1 && out_batch_axis == 0 && out_channel_axis == 1 &&
+                    is_unit(stride) && is_unit(filter_dilation) && is_unit(in_dilation) &&
+                    in_pad_below[0] >= 0 && in_pad_below[1] >= 0 && in_pad_above[0] >= 0 &&
+                    in_pad_above[1] >= 0;
+
+                if (use_winograd)
+                {
+                    convolution_winograd_3x3<INPUT, FILTER, OUTPUT, ACCUMULATION>(
+                        in, filter, out, in_shape, filter_shape, out_shape, in_pad_below);
+                }
+                else
+                {
+                    general_convolution_im2col<INPUT, FILTER, OUTPUT, ACCUMULATION>(
+                        in,
+                        filter,
+                        out,
+                        in_shape,
+                        filter_shape,
+                        out_shape,
+                        stride,
+                        filter_dilation,
+                        in_pad_below,
+                        in_pad_above,
+                        in_dilation,
+                        in_batch_axis,
+                        in_channel_axis,
+                        filter_out_channel_axis,
+                        filter_in_channel_axis,
+                        out_batch_axis,
+                        out_channel_axis,
+                        input_scale,
+                        input_zero_point,
+                        filter_scale,
+                        filter_zero_point,
+                        output_scale,
+                        output_zero_point);
+                }
+            }
+
             template <typename INPUT,
                       typename FILTER,
                       typename OUTPUT,
@@ -20,6 +20,8 @@
 #include <stdexcept>
 #include <type_traits>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -36,34 +38,38 @@ namespace ngraph
             {
                 if (pythondiv)
                 {
-                    for (size_t i = 0; i < count; i++)
-                    {
-                        if (arg1[i] == 0)
-                        {
-                            throw std::domain_error("integer division by zero");
-                        }
-                        T quot = arg0[i] / arg1[i];
-                        T rem = arg0[i] % arg1[i];
-                        if ((rem != 0) && ((arg0[i] < 0) != (arg1[i] < 0)))
+                    parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
                         {
-                            out[i] = quot - 1;
+                            if (arg1[i] == 0)
+                            {
+                                throw std::domain_error("integer division by zero");
+                            }
+                            T quot = arg0[i] / arg1[i];
+                            T rem = arg0[i] % arg1[i];
+                            if ((rem != 0) && ((arg0[i] < 0) != (arg1[i] < 0)))
+                            {
+                                out[i] = quot - 1;
+                            }
+                            else
+                            {
+                                out[i] = quot;
+                            }
                         }
-                        else
-                        {
-                            out[i] = quot;
-                        }
-                    }
+                    });
                 }
                 else
                 {
-                    for (size_t i = 0; i < count; i++)
-                    {
-                        if (arg1[i] == 0)
+                    parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
                         {
-                            throw std::domain_error("integer division by zero");
+                            if (arg1[i] == 0)
+                            {
+                                throw std::domain_error("integer division by zero");
+                            }
+                            out[i] = arg0[i] / arg1[i];
                         }
-                        out[i] = arg0[i] / arg1[i];
-                    }
+                    });
                 }
             }
 
@@ -117,12 +123,14 @@ namespace ngraph
                 divide(const T* arg0, const T* arg1, T* out, size_t count, bool pythondiv)
             {
                 (void)pythondiv;
-                for (size_t i = 0; i < count; i++)
-                {
-                    // TODO: Here we do not check for div by zero, so we'll get +-inf here
-                    // if arg1[i] == 0. Is that the right thing to do? Jury's still out.
-                    out[i] = arg0[i] / arg1[i];
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        // TODO: Here we do not check for div by zero, so we'll get +-inf here
+                        // if arg1[i] == 0. Is that the right thing to do? Jury's still out.
+                        out[i] = arg0[i] / arg1[i];
+                    }
+                });
             }
 
             template <typename T>
@@ -23,6 +23,8 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -35,10 +37,12 @@ namespace ngraph
                        char* out,
                        size_t count) // TODO: using char for bool, is this right?
             {
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = arg0[i] == arg1[i];
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = arg0[i] == arg1[i];
+                    }
+                });
             }
 
             template <typename T>
@@ -17,9 +17,13 @@
 #pragma once
 
 #include <numeric>
+#include <utility>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape_util.hpp"
 
 namespace ngraph
 {
@@ -146,29 +150,41 @@ namespace ngraph
                                                         out_inner_strides,
                                                         out_inner_axis_order);
 
+                // Collect the offsets of all sub-problems first so they can be solved in
+                // parallel; every sub-problem writes to its own slice of out.
+                std::vector<std::pair<size_t, size_t>> outer_offsets;
                 auto out_outer_coord_iter = out_outer_transform.begin();
                 for (const Coordinate& params_outer_coord : params_outer_transform)
                 {
-                    const T* params_prime =
-                        &params[params_outer_transform.index(params_outer_coord)];
-                    T* out_outer = &out[out_outer_transform.index(*out_outer_coord_iter)];
+                    outer_offsets.emplace_back(params_outer_transform.index(params_outer_coord),
+                                               out_outer_transform.index(*out_outer_coord_iter));
+                    out_outer_coord_iter++;
+                }
 
-                    auto out_inner_coord_iter = out_inner_transform.begin();
-                    for (const Coordinate& indices_outer_coord : indices_outer_transform)
+                std::vector<std::pair<size_t, size_t>> inner_offsets;
+                auto out_inner_coord_iter = out_inner_transform.begin();
+                for (const Coordinate& indices_outer_coord : indices_outer_transform)
+                {
+                    inner_offsets.emplace_back(indices_outer_transform.index(indices_outer_coord),
+                                               out_inner_transform.index(*out_inner_coord_iter));
+                    out_inner_coord_iter++;
+                }
+
+                size_t n_inner = inner_offsets.size();
+                size_t grain = parallel_grain(shape_size(out_prime_shape));
+                parallel_for(outer_offsets.size() * n_inner, grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
                     {
-                        const U* indices_prime =
-                            &indices[indices_outer_transform.index(indices_outer_coord)];
-                        T* out_prime = &out_outer[out_inner_transform.index(*out_inner_coord_iter)];
-                        gather_nd<T, U>(params_prime,
-                                        indices_prime,
-                                        out_prime,
+                        const std::pair<size_t, size_t>& outer = outer_offsets[i / n_inner];
+                        const std::pair<size_t, size_t>& inner = inner_offsets[i % n_inner];
+                        gather_nd<T, U>(&params[outer.first],
+                                        &indices[inner.first],
+                                        &out[outer.second + inner.second],
                                         params_prime_shape,
                                         indices_prime_shape,
                                         out_prime_shape);
-                        out_inner_coord_iter++;
                     }
-                    out_outer_coord_iter++;
-                }
+                });
             }
         }
     }
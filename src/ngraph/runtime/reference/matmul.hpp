@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "ngraph/runtime/thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Block sizes for blocked_matmul. A block_m x block_n tile of accumulators and a
+            // block_k x block_n panel of arg1 are kept hot while rows of arg0 are streamed.
+            static const size_t dot_block_m = 64;
+            static const size_t dot_block_n = 256;
+            static const size_t dot_block_k = 128;
+
+            // Computes sum_k (arg0[m, k] - zero_point0) * (arg1[k, n] - zero_point1) for
+            // row-major M x K and K x N matrices and hands each finished sum to
+            // store(m * N + n, sum). The products for every output are accumulated in ascending
+            // k order, exactly as in a naive triple loop, so blocking does not change results.
+            // The innermost loop runs over a contiguous row of the packed arg1 panel so the
+            // compiler can vectorize it.
+            template <typename INPUT0, typename INPUT1, typename ACCUMULATION, typename STORE>
+            void blocked_matmul(const INPUT0* arg0,
+                                const INPUT1* arg1,
+                                size_t m_size,
+                                size_t k_size,
+                                size_t n_size,
+                                ACCUMULATION zero_point0,
+                                ACCUMULATION zero_point1,
+                                STORE store)
+            {
+                // Rows of the result are independent, so they are split over the intra-op
+                // thread pool without changing the order of any accumulation.
+                size_t grain = parallel_grain(k_size * n_size);
+                parallel_for(m_size, grain, [&](size_t m_begin, size_t m_end) {
+                    // Small products only get buffers as large as their matrices. The tile is
+                    // cleared for every block and the panel packed before use, so neither is
+                    // initialized here.
+                    size_t tile_n = std::min(dot_block_n, n_size);
+                    std::unique_ptr<ACCUMULATION[]> tile(
+                        new ACCUMULATION[std::min(dot_block_m, m_end - m_begin) * tile_n]);
+                    std::unique_ptr<ACCUMULATION[]> panel(
+                        new ACCUMULATION[std::min(dot_block_k, k_size) * tile_n]);
+
+                    for (size_t n0 = 0; n0 < n_size; n0 += dot_block_n)
+                    {
+                        size_t nb = std::min(dot_block_n, n_size - n0);
+                        for (size_t m0 = m_begin; m0 < m_end; m0 += dot_block_m)
+                        {
+                            size_t mb = std::min(dot_block_m, m_end - m0);
+                            std::fill(tile.get(), tile.get() + mb * nb, ACCUMULATION(0));
+
+                            for (size_t k0 = 0; k0 < k_size; k0 += dot_block_k)
+                            {
+                                size_t kb = std::min(dot_block_k, k_size - k0);
+
+                                // Pack and widen the arg1 panel once for all rows of the tile.
+                                for (size_t k = 0; k < kb; k++)
+                                {
+                                    const INPUT1* src = arg1 + (k0 + k) * n_size + n0;
+                                    ACCUMULATION* dst = panel.get() + k * nb;
+                                    for (size_t n = 0; n < nb; n++)
+                                    {
+                                        dst[n] = static_cast<ACCUMULATION>(src[n]) - zero_point1;
+                                    }
+                                }
+
+                                for (size_t m = 0; m < mb; m++)
+                                {
+                                    const INPUT0* a_row = arg0 + (m0 + m) * k_size + k0;
+                                    ACCUMULATION* c = tile.get() + m * nb;
+                                    for (size_t k = 0; k < kb; k++)
+                                    {
+                                        ACCUMULATION a =
+                                            static_cast<ACCUMULATION>(a_row[k]) - zero_point0;
+                                        const ACCUMULATION* b = panel.get() + k * nb;
+                                        for (size_t n = 0; n < nb; n++)
+                                        {
+                                            c[n] += a * b[n];
+                                        }
+                                    }
+                                }
+                            }
+
+                            for (size_t m = 0; m < mb; m++)
+                            {
+                                const ACCUMULATION* c = tile.get() + m * nb;
+                                size_t out_index = (m0 + m) * n_size + n0;
+                                for (size_t n = 0; n < nb; n++)
+                                {
+                                    store(out_index + n, c[n]);
+                                }
+                            }
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
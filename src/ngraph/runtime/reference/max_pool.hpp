@@ -20,6 +20,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -45,10 +46,7 @@ namespace ngraph
                     out[out_transform.index(out_coord)] = 0;
                 }
 
-                CoordinateTransform delta_transform(delta_shape);
-
-                for (const Coordinate& delta_coord : delta_transform)
-                {
+                parallel_plane_walk(delta_shape, [&](const Coordinate& delta_coord, size_t index) {
                     size_t img_index = delta_coord[0];
                     size_t channel = delta_coord[1];
 
@@ -115,10 +113,9 @@ namespace ngraph
 
                     if (argmax_coord_valid)
                     {
-                        out[source_window_transform.index(argmax_coord)] +=
-                            delta[delta_transform.index(delta_coord)];
+                        out[source_window_transform.index(argmax_coord)] += delta[index];
                     }
-                }
+                });
             }
 
             template <typename T>
@@ -132,10 +129,7 @@ namespace ngraph
                           const Shape& padding_above)
             {
                 // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& out_coord : output_transform)
-                {
+                parallel_plane_walk(out_shape, [&](const Coordinate& out_coord, size_t out_index) {
                     // Our output coordinate O will have the form:
                     //
                     //   (N,chan,i_1,...,i_n)
@@ -208,17 +202,29 @@ namespace ngraph
 
                     T result = std::numeric_limits<T>::lowest();
 
-                    for (const Coordinate& input_batch_coord : input_batch_transform)
+                    if (input_batch_transform.has_all_source_coordinates())
                     {
-                        if (input_batch_transform.has_source_coordinate(input_batch_coord))
+                        // The window does not touch the padding, so walk it without checks.
+                        for (size_t input_index : input_batch_transform.source_indices())
                         {
-                            T x = arg[input_batch_transform.index(input_batch_coord)];
+                            T x = arg[input_index];
                             result = x > result ? x : result;
                         }
                     }
+                    else
+                    {
+                        for (const Coordinate& input_batch_coord : input_batch_transform)
+                        {
+                            if (input_batch_transform.has_source_coordinate(input_batch_coord))
+                            {
+                                T x = arg[input_batch_transform.index(input_batch_coord)];
+                                result = x > result ? x : result;
+                            }
+                        }
+                    }
 
-                    out[output_transform.index(out_coord)] = result;
-                }
+                    out[out_index] = result;
+                });
             }
         }
     }
@@ -18,6 +18,8 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -27,10 +29,12 @@ namespace ngraph
             template <typename T>
             void maximum(const T* arg0, const T* arg1, T* out, size_t count)
             {
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = arg0[i] > arg1[i] ? arg0[i] : arg1[i];
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = arg0[i] > arg1[i] ? arg0[i] : arg1[i];
+                    }
+                });
             }
 
             template <typename T>
@@ -17,8 +17,9 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
 
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
@@ -30,6 +31,28 @@ namespace ngraph
     {
         namespace reference
         {
+            // Divides a sum of count elements by count. The count is not narrowed to T, which
+            // for small integer types could make it negative or zero.
+            template <typename T>
+            typename std::enable_if<std::is_integral<T>::value, T>::type
+                mean_divide(T sum, size_t count)
+            {
+                using Wide =
+                    typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type;
+                if (count == 0)
+                {
+                    return sum;
+                }
+                return static_cast<T>(static_cast<Wide>(sum) / static_cast<Wide>(count));
+            }
+
+            template <typename T>
+            typename std::enable_if<!std::is_integral<T>::value, T>::type
+                mean_divide(T sum, size_t count)
+            {
+                return static_cast<T>(static_cast<double>(sum) / count);
+            }
+
             template <typename T>
             void mean(const T* arg,
                       T* out,
@@ -37,52 +60,17 @@ namespace ngraph
                       const Shape& out_shape,
                       const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
+                sum(arg, out, in_shape, out_shape, reduction_axes);
 
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
-
-                for (const Coordinate& input_coord : input_transform)
+                size_t count = 1;
+                for (size_t axis : reduction_axes)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
+                    count *= in_shape[axis];
                 }
-
-                for (const Coordinate& output_coord : output_transform)
+                size_t out_size = shape_size(out_shape);
+                for (size_t i = 0; i < out_size; i++)
                 {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
+                    out[i] = mean_divide(out[i], count);
                 }
             }
         }
@@ -19,7 +19,7 @@
 #include <cmath>
 #include <limits>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 #ifdef _WIN32
@@ -42,26 +42,9 @@ namespace ngraph
                 T minval = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
                                                                 : std::numeric_limits<T>::max();
 
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T min = out[output_transform.index(output_coord)];
-                    if (x < min)
-                    {
-                        out[output_transform.index(output_coord)] = x;
-                    }
-                }
+                auto op = [](T a, T x) { return x < a ? x : a; };
+                auto reducer = make_elementwise_reducer(minval, op);
+                reduction(arg, out, in_shape, out_shape, reduction_axes, reducer);
             }
         }
     }
@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/pad.hpp" // for op::PadMode
+#include "ngraph/runtime/reference/strided_copy.hpp"
 
 namespace ngraph
 {
@@ -29,6 +31,101 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Returns the coordinate along one axis of the input element that is written
+            /// to position of the output, or -1 if pad_mode is CONSTANT and the pad value is.
+            inline std::ptrdiff_t pad_source_coordinate(op::PadMode pad_mode,
+                                                        std::ptrdiff_t position,
+                                                        std::ptrdiff_t below,
+                                                        std::ptrdiff_t size,
+                                                        std::ptrdiff_t above)
+            {
+                // Input coordinates are offset by below in the padded output
+                std::ptrdiff_t c = position;
+                switch (pad_mode)
+                {
+                case op::PadMode::CONSTANT:
+                    if (c < below || c >= below + size)
+                    {
+                        return -1;
+                    }
+                    break;
+                case op::PadMode::EDGE:
+                    // Truncate out-of-bound positions
+                    c = std::min(std::max(c, below), below + size - 1);
+                    break;
+                case op::PadMode::REFLECT:
+                {
+                    // clang-format off
+                    // The algorithm here is a bit complicated because if the padding is
+                    // bigger than the tensor, we may reflect multiple times.
+                    //
+                    // Example:
+                    //
+                    // Input shape:     [2]
+                    // Padding:         6 below, 6 above
+                    // Output shape:    [14]
+                    //
+                    // Input:                       a b
+                    // Expected output: a b a b a b a b a b a b a b
+                    //
+                    // Computation for coordinate 13 of output:
+                    //
+                    //         . . . . . . a b . . . . .[.] -> (oob above by 6 spaces, so reflection is at top-6)
+                    //         .[.]. . . . a b . . . . . .  -> (oob below by 5 spaces, so reflection is at bottom+5)
+                    //         . . . . . . a b . . .[.]. .  -> (oob above by 4 spaces, so reflection is at top-4)
+                    //         . . .[.]. . a b . . . . . .  -> (oob below by 3 spaces, so reflection is at bottom+3)
+                    //         . . . . . . a b .[.]. . . .  -> (oob above by 2 spaces, so reflection is at top-2)
+                    //         . . . . .[.]a b . . . . . .  -> (oob below by 1 space,  so reflection is at bottom+1)
+                    //         . . . . . . a[b]. . . . . .  -> (no longer oob, so copy from here)
+                    //
+                    // Note that this algorithm works because REFLECT padding only makes sense
+                    // if each dim is >= 2.
+                    // clang-format on
+                    bool done_reflecting = false;
+                    while (!done_reflecting)
+                    {
+                        if (c < below)
+                        {
+                            std::ptrdiff_t distance_oob = below - c;
+                            c = below + distance_oob;
+                        }
+                        else if (c >= below + size)
+                        {
+                            std::ptrdiff_t distance_oob = c - below - (size - 1);
+                            c = below + size - distance_oob - 1;
+                        }
+                        else
+                        {
+                            done_reflecting = true;
+                        }
+                    }
+                    break;
+                }
+                case op::PadMode::SYMMETRIC:
+                {
+                    std::ptrdiff_t pos = below - (c + 1);
+                    if (pos >= 0)
+                    {
+                        c = pos + below;
+                    }
+                    else
+                    {
+                        pos = -(pos + 1);
+                        if (pos < size)
+                        {
+                            c = pos + below;
+                        }
+                        else
+                        {
+                            c = below + size + above - pos;
+                        }
+                    }
+                    break;
+                }
+                }
+                return c - below;
+            }
+
             template <typename T>
             void pad(const T* arg0,
                      const T* arg1,
@@ -39,164 +136,121 @@ namespace ngraph
                      const CoordinateDiff& padding_above,
                      op::PadMode pad_mode)
             {
-                Coordinate input_start(arg0_shape.size(), 0); // start at (0,0,...,0)
-                Coordinate input_end = out_shape; // end at (d'0,d'1,...,d'n), the outer corner of
-                                                  // the post-padding shape
-
-                Strides input_strides(arg0_shape.size(), 1);
-
-                AxisVector input_axis_order(arg0_shape.size());
-                for (size_t i = 0; i < arg0_shape.size(); i++)
+                size_t rank = arg0_shape.size();
+                size_t out_size = shape_size(out_shape);
+                if (out_size == 0)
                 {
-                    input_axis_order[i] = i;
+                    return;
                 }
 
-                CoordinateTransform input_transform(arg0_shape,
-                                                    input_start,
-                                                    input_end,
-                                                    input_strides,
-                                                    input_axis_order,
-                                                    padding_below,
-                                                    padding_above);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                // For every output position along each axis, the input coordinate it takes its
+                // value from
+                std::vector<std::vector<std::ptrdiff_t>> sources(rank);
+                // The block of the output that holds the input elements kept by the padding
+                Shape interior_shape(rank);
+                std::vector<std::ptrdiff_t> interior_in_start(rank);
+                std::vector<std::ptrdiff_t> interior_out_start(rank);
+                CopyStrides arg0_strides = row_major_copy_strides(arg0_shape);
+                CopyStrides out_strides = row_major_copy_strides(out_shape);
+                std::ptrdiff_t in_offset = 0;
+                std::ptrdiff_t out_offset = 0;
+                for (size_t i = 0; i < rank; i++)
                 {
-                    const Coordinate& out_coord = *output_it;
+                    std::ptrdiff_t size = arg0_shape[i];
+                    NGRAPH_CHECK(padding_below[i] + size + padding_above[i] ==
+                                 static_cast<std::ptrdiff_t>(out_shape[i]));
+                    for (size_t position = 0; position < out_shape[i]; position++)
+                    {
+                        sources[i].push_back(pad_source_coordinate(
+                            pad_mode, position, padding_below[i], size, padding_above[i]));
+                    }
+                    interior_in_start[i] = std::max<std::ptrdiff_t>(0, -padding_below[i]);
+                    interior_out_start[i] = std::max<std::ptrdiff_t>(0, padding_below[i]);
+                    std::ptrdiff_t interior_size = size - interior_in_start[i] -
+                                                   std::max<std::ptrdiff_t>(0, -padding_above[i]);
+                    interior_shape[i] = std::max<std::ptrdiff_t>(0, interior_size);
+                    in_offset += interior_in_start[i] * arg0_strides[i];
+                    out_offset += interior_out_start[i] * out_strides[i];
+                }
 
-                    T v(0);
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    if (shape_size(interior_shape) < out_size)
+                    {
+                        T value = *arg1;
+                        parallel_for(
+                            out_size, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                                std::fill(out + begin, out + end, value);
+                            });
+                    }
+                    strided_copy(arg0 + in_offset,
+                                 arg0_strides,
+                                 out + out_offset,
+                                 out_strides,
+                                 interior_shape);
+                    return;
+                }
 
-                    switch (pad_mode)
+                // Every other mode repeats input elements. If all of them are in the interior,
+                // the padding is filled one axis at a time by copying the slabs of the output
+                // it repeats.
+                bool sources_in_interior = true;
+                for (size_t i = 0; i < rank; i++)
+                {
+                    for (std::ptrdiff_t source : sources[i])
                     {
-                    case op::PadMode::CONSTANT:
-                        // If the coordinate is out of bounds, substitute *arg1.
-                        v = input_transform.has_source_coordinate(in_coord)
-                                ? arg0[input_transform.index(in_coord)]
-                                : *arg1;
-                        break;
-                    case op::PadMode::EDGE:
+                        std::ptrdiff_t interior_position = source - interior_in_start[i];
+                        sources_in_interior &=
+                            interior_position >= 0 &&
+                            interior_position < static_cast<std::ptrdiff_t>(interior_shape[i]);
+                    }
+                }
+                if (!sources_in_interior)
+                {
+                    CoordinateTransform output_transform(out_shape);
+                    size_t out_index = 0;
+                    for (const Coordinate& out_coord : output_transform)
                     {
-                        Coordinate c = in_coord; // have to copy because in_coord is const
-
-                        // Truncate each out-of-bound dimension.
-                        for (size_t i = 0; i < c.size(); i++)
+                        std::ptrdiff_t in_index = 0;
+                        for (size_t i = 0; i < rank; i++)
                         {
-                            if (static_cast<ptrdiff_t>(c[i]) < padding_below[i])
-                            {
-                                c[i] = padding_below[i];
-                            }
-
-                            if (static_cast<ptrdiff_t>(c[i]) >=
-                                (padding_below[i] + static_cast<ptrdiff_t>(arg0_shape[i])))
-                            {
-                                c[i] = static_cast<size_t>(
-                                    padding_below[i] + static_cast<ptrdiff_t>(arg0_shape[i]) - 1);
-                            }
+                            in_index += sources[i][out_coord[i]] * arg0_strides[i];
                         }
-                        v = arg0[input_transform.index(c)];
-                        break;
+                        out[out_index++] = arg0[in_index];
                     }
-                    case op::PadMode::REFLECT:
-                    {
-                        // clang-format off
-                        // The algorithm here is a bit complicated because if the padding is
-                        // bigger than the tensor, we may reflect multiple times.
-                        //
-                        // Example:
-                        //
-                        // Input shape:     [2]
-                        // Padding:         6 below, 6 above
-                        // Output shape:    [14]
-                        //
-                        // Input:                       a b
-                        // Expected output: a b a b a b a b a b a b a b
-                        //
-                        // Computation for coordinate 13 of output:
-                        //
-                        //         . . . . . . a b . . . . .[.] -> (oob above by 6 spaces, so reflection is at top-6)
-                        //         .[.]. . . . a b . . . . . .  -> (oob below by 5 spaces, so reflection is at bottom+5)
-                        //         . . . . . . a b . . .[.]. .  -> (oob above by 4 spaces, so reflection is at top-4)
-                        //         . . .[.]. . a b . . . . . .  -> (oob below by 3 spaces, so reflection is at bottom+3)
-                        //         . . . . . . a b .[.]. . . .  -> (oob above by 2 spaces, so reflection is at top-2)
-                        //         . . . . .[.]a b . . . . . .  -> (oob below by 1 space,  so reflection is at bottom+1)
-                        //         . . . . . . a[b]. . . . . .  -> (no longer oob, so copy from here)
-                        //
-                        // Note that this algorithm works because REFLECT padding only makes sense
-                        // if each dim is >= 2.
-                        // clang-format on
-                        Coordinate c = in_coord; // have to copy because in_coord is const
-
-                        for (size_t i = 0; i < c.size(); i++)
-                        {
-                            ptrdiff_t new_dim = c[i];
-                            bool done_reflecting = false;
-
-                            while (!done_reflecting)
-                            {
-                                if (new_dim < padding_below[i])
-                                {
-                                    ptrdiff_t distance_oob = padding_below[i] - new_dim;
-                                    new_dim = padding_below[i] + distance_oob;
-                                }
-                                else if (new_dim >=
-                                         padding_below[i] + static_cast<ptrdiff_t>(arg0_shape[i]))
-                                {
-                                    ptrdiff_t distance_oob =
-                                        new_dim - padding_below[i] -
-                                        (static_cast<ptrdiff_t>(arg0_shape[i]) - 1);
-                                    new_dim = padding_below[i] +
-                                              static_cast<ptrdiff_t>(arg0_shape[i]) - distance_oob -
-                                              1;
-                                }
-                                else
-                                {
-                                    done_reflecting = true;
-                                }
-                            }
+                    return;
+                }
 
-                            c[i] = static_cast<size_t>(new_dim);
-                        }
-                        v = arg0[input_transform.index(c)];
-                        break;
+                strided_copy(
+                    arg0 + in_offset, arg0_strides, out + out_offset, out_strides, interior_shape);
+                // Once axis i is done, the output is filled along axes up to i and in the
+                // interior of the axes after it
+                Shape slab_shape = interior_shape;
+                for (size_t i = 0; i < rank; i++)
+                {
+                    slab_shape[i] = 1;
+                    std::ptrdiff_t slab_offset = out_offset;
+                    for (size_t j = 0; j <= i; j++)
+                    {
+                        slab_offset -= interior_out_start[j] * out_strides[j];
                     }
-                    case op::PadMode::SYMMETRIC:
+                    std::ptrdiff_t interior_end = interior_out_start[i] + interior_shape[i];
+                    for (size_t position = 0; position < out_shape[i]; position++)
                     {
-                        Coordinate c = in_coord; // have to copy because in_coord is const
-                        for (size_t i = 0; i < c.size(); i++)
+                        std::ptrdiff_t p = position;
+                        if (p >= interior_out_start[i] && p < interior_end)
                         {
-                            ptrdiff_t pos = padding_below[i] - (c[i] + 1);
-                            if (pos >= 0)
-                            {
-                                c[i] = static_cast<size_t>(pos + padding_below[i]);
-                            }
-                            else
-                            {
-                                pos = -(pos + 1);
-                                ptrdiff_t src_dim = static_cast<ptrdiff_t>(arg0_shape[i]);
-                                if (pos < src_dim)
-                                {
-                                    c[i] = static_cast<size_t>(pos + padding_below[i]);
-                                }
-                                else
-                                {
-                                    c[i] = static_cast<size_t>(padding_below[i] + src_dim +
-                                                               padding_above[i] - pos);
-                                }
-                            }
+                            continue;
                         }
-                        v = arg0[input_transform.index(c)];
-                        break;
+                        std::ptrdiff_t source =
+                            sources[i][position] - interior_in_start[i] + interior_out_start[i];
+                        strided_copy(out + slab_offset + source * out_strides[i],
+                                     out_strides,
+                                     out + slab_offset + p * out_strides[i],
+                                     out_strides,
+                                     slab_shape);
                     }
-                    }
-
-                    out[output_transform.index(out_coord)] = v;
-
-                    ++output_it;
+                    slab_shape[i] = out_shape[i];
                 }
             }
         }
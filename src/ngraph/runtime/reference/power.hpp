@@ -20,6 +20,7 @@
 #include <cstddef>
 
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -31,10 +32,12 @@ namespace ngraph
             template <typename T>
             void power(const T* arg0, const T* arg1, T* out, size_t count)
             {
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = std::pow(arg0[i], arg1[i]);
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = std::pow(arg0[i], arg1[i]);
+                    }
+                });
             }
 
             template <typename T>
@@ -18,7 +18,7 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -34,23 +34,9 @@ namespace ngraph
                          const Shape& out_shape,
                          const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    size_t output_index = output_transform.index(output_coord);
-
-                    out[output_index] = out[output_index] * arg[input_transform.index(input_coord)];
-                }
+                auto op = [](T a, T x) { return a * x; };
+                auto reducer = make_elementwise_reducer(T(1), op);
+                reduction(arg, out, in_shape, out_shape, reduction_axes, reducer);
             }
         }
     }
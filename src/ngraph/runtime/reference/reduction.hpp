@@ -0,0 +1,360 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Reductions are cut into blocks of about this many elements. The blocks depend only
+            // on the shapes involved and their partial results are always combined in the same
+            // order, so results do not depend on the number of threads.
+            static const size_t reduction_block_size = 16384;
+            // Reductions over an outer axis walk their rows this many columns at a time
+            static const size_t reduction_column_chunk = 256;
+            // Number of independent accumulators used along a contiguous row
+            static const size_t reduction_lanes = 8;
+
+            // Reduces n contiguous elements with op, spreading them over reduction_lanes
+            // accumulators so consecutive elements do not wait on each other.
+            template <typename T, typename OP>
+            T reduce_row_in_lanes(const T* in, size_t n, T identity, OP op)
+            {
+                T lanes[reduction_lanes];
+                std::fill(lanes, lanes + reduction_lanes, identity);
+                size_t i = 0;
+                for (; i + reduction_lanes <= n; i += reduction_lanes)
+                {
+                    for (size_t lane = 0; lane < reduction_lanes; lane++)
+                    {
+                        lanes[lane] = op(lanes[lane], in[i + lane]);
+                    }
+                }
+                for (size_t width = reduction_lanes / 2; width > 0; width /= 2)
+                {
+                    for (size_t lane = 0; lane < width; lane++)
+                    {
+                        lanes[lane] = op(lanes[lane], lanes[lane + width]);
+                    }
+                }
+                T result = lanes[0];
+                for (; i < n; i++)
+                {
+                    result = op(result, in[i]);
+                }
+                return result;
+            }
+
+            // A reducer for an op that is applied element by element and whose result does not
+            // depend on the order of the elements, such as max or product.
+            //
+            // Reducers passed to reduction() provide
+            //   T reduce_row(const T* in, size_t n)
+            //       to reduce n contiguous elements, and
+            //   void reduce_columns(const T* in, size_t rows, size_t columns, size_t stride,
+            //                       T* out)
+            //       to reduce rows rows, stride elements apart, of at most reduction_column_chunk
+            //       contiguous elements into out.
+            // Both produce the identity of the reduction when there is nothing to reduce.
+            template <typename T, typename OP>
+            class ElementwiseReducer
+            {
+            public:
+                ElementwiseReducer(T identity, OP op)
+                    : m_identity(identity)
+                    , m_op(op)
+                {
+                }
+
+                T reduce_row(const T* in, size_t n) const
+                {
+                    return reduce_row_in_lanes(in, n, m_identity, m_op);
+                }
+
+                void reduce_columns(
+                    const T* in, size_t rows, size_t columns, size_t stride, T* out) const
+                {
+                    T result[reduction_column_chunk];
+                    std::fill(result, result + columns, m_identity);
+                    for (size_t row = 0; row < rows; row++)
+                    {
+                        const T* x = in + row * stride;
+                        for (size_t column = 0; column < columns; column++)
+                        {
+                            result[column] = m_op(result[column], x[column]);
+                        }
+                    }
+                    std::copy(result, result + columns, out);
+                }
+
+            private:
+                T m_identity;
+                OP m_op;
+            };
+
+            template <typename T, typename OP>
+            ElementwiseReducer<T, OP> make_elementwise_reducer(T identity, OP op)
+            {
+                return ElementwiseReducer<T, OP>(identity, op);
+            }
+
+            // Reduces outer rows of reduced contiguous elements into out[outer]. Long rows are
+            // reduced in blocks whose results are then reduced like a row of their own.
+            template <typename T, typename REDUCER>
+            void reduce_last_axis(
+                const T* arg, T* out, size_t outer, size_t reduced, const REDUCER& reducer)
+            {
+                size_t n_blocks = (reduced + reduction_block_size - 1) / reduction_block_size;
+                if (n_blocks <= 1)
+                {
+                    parallel_for(outer, parallel_grain(reduced), [&](size_t begin, size_t end) {
+                        for (size_t row = begin; row < end; row++)
+                        {
+                            out[row] = reducer.reduce_row(arg + row * reduced, reduced);
+                        }
+                    });
+                    return;
+                }
+
+                std::vector<T> partials(outer * n_blocks);
+                parallel_for(outer * n_blocks, 1, [&](size_t begin, size_t end) {
+                    for (size_t item = begin; item < end; item++)
+                    {
+                        size_t row = item / n_blocks;
+                        size_t offset = item % n_blocks * reduction_block_size;
+                        size_t n = std::min(reduction_block_size, reduced - offset);
+                        partials[item] = reducer.reduce_row(arg + row * reduced + offset, n);
+                    }
+                });
+                for (size_t row = 0; row < outer; row++)
+                {
+                    out[row] = reducer.reduce_row(partials.data() + row * n_blocks, n_blocks);
+                }
+            }
+
+            // Reduces an [outer, reduced, inner] tensor over its middle axis into [outer, inner].
+            // The rows are walked a chunk of columns at a time, and long columns are reduced in
+            // blocks of rows whose results are then reduced like columns of their own.
+            template <typename T, typename REDUCER>
+            void reduce_middle_axis(const T* arg,
+                                    T* out,
+                                    size_t outer,
+                                    size_t reduced,
+                                    size_t inner,
+                                    const REDUCER& reducer)
+            {
+                size_t chunk = std::min(inner, reduction_column_chunk);
+                size_t n_chunks = (inner + chunk - 1) / chunk;
+                size_t block_rows = std::max<size_t>(1, reduction_block_size / chunk);
+                size_t n_blocks = (reduced + block_rows - 1) / block_rows;
+
+                // Reduces [outer, rows, inner] src into [outer, blocks, inner] dst
+                auto reduce_blocks = [&](const T* src, size_t rows, size_t blocks, T* dst) {
+                    size_t rows_per_block = blocks > 1 ? block_rows : rows;
+                    size_t grain = parallel_grain(rows_per_block * chunk);
+                    parallel_for(outer * blocks * n_chunks, grain, [&](size_t begin, size_t end) {
+                        for (size_t item = begin; item < end; item++)
+                        {
+                            size_t column = item % n_chunks * chunk;
+                            size_t block = item / n_chunks % blocks;
+                            size_t o = item / n_chunks / blocks;
+                            size_t first_row = block * rows_per_block;
+                            reducer.reduce_columns(
+                                src + (o * rows + first_row) * inner + column,
+                                std::min(rows_per_block, rows - first_row),
+                                std::min(chunk, inner - column),
+                                inner,
+                                dst + (o * blocks + block) * inner + column);
+                        }
+                    });
+                };
+
+                if (n_blocks <= 1)
+                {
+                    reduce_blocks(arg, reduced, 1, out);
+                }
+                else
+                {
+                    std::vector<T> partials(outer * n_blocks * inner);
+                    reduce_blocks(arg, reduced, n_blocks, partials.data());
+                    reduce_blocks(partials.data(), n_blocks, 1, out);
+                }
+            }
+
+            // Reduces arg of shape in_shape over reduction_axes into out with reducer.
+            //
+            // Axes of length 1 are dropped and neighbouring axes that are both reduced or both
+            // kept are merged. What is left alternates between kept and reduced axes. The last
+            // reduced axis is then reduced, either along contiguous rows or, when kept axes
+            // follow it, across rows, until only kept axes remain.
+            template <typename T, typename REDUCER>
+            void reduction(const T* arg,
+                           T* out,
+                           const Shape& in_shape,
+                           const Shape& out_shape,
+                           const AxisSet& reduction_axes,
+                           const REDUCER& reducer)
+            {
+                size_t out_size = shape_size(out_shape);
+                if (out_size == 0)
+                {
+                    return;
+                }
+
+                std::vector<size_t> sizes;
+                std::vector<bool> reduced;
+                for (size_t axis = 0; axis < in_shape.size(); axis++)
+                {
+                    if (in_shape[axis] == 0)
+                    {
+                        std::fill(out, out + out_size, reducer.reduce_row(arg, 0));
+                        return;
+                    }
+                    if (in_shape[axis] == 1)
+                    {
+                        continue;
+                    }
+                    bool is_reduced = reduction_axes.count(axis) != 0;
+                    if (!sizes.empty() && reduced.back() == is_reduced)
+                    {
+                        sizes.back() *= in_shape[axis];
+                    }
+                    else
+                    {
+                        sizes.push_back(in_shape[axis]);
+                        reduced.push_back(is_reduced);
+                    }
+                }
+
+                const T* in = arg;
+                std::vector<T> temp;
+                while (true)
+                {
+                    auto last = std::find(reduced.rbegin(), reduced.rend(), true);
+                    if (last == reduced.rend())
+                    {
+                        std::copy(in, in + out_size, out);
+                        return;
+                    }
+                    size_t axis = reduced.rend() - last - 1;
+                    size_t outer = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= sizes[i];
+                    }
+                    size_t inner = axis + 1 < sizes.size() ? sizes[axis + 1] : 1;
+
+                    // Groups alternate, so axis is the only reduced one unless it is past 1
+                    bool last_stage = axis <= 1;
+                    std::vector<T> next(last_stage ? 0 : outer * inner);
+                    T* dst = last_stage ? out : next.data();
+                    if (inner == 1)
+                    {
+                        reduce_last_axis(in, dst, outer, sizes[axis], reducer);
+                    }
+                    else
+                    {
+                        reduce_middle_axis(in, dst, outer, sizes[axis], inner, reducer);
+                    }
+                    if (last_stage)
+                    {
+                        return;
+                    }
+                    temp = std::move(next);
+                    in = temp.data();
+
+                    // The kept axes on either side of axis become neighbours
+                    if (inner > 1)
+                    {
+                        sizes[axis - 1] *= inner;
+                        sizes.erase(sizes.begin() + axis + 1);
+                        reduced.erase(reduced.begin() + axis + 1);
+                    }
+                    sizes.erase(sizes.begin() + axis);
+                    reduced.erase(reduced.begin() + axis);
+                }
+            }
+
+            // Writes the index along axis of the first element for which no other element along
+            // axis is better. Each output is found by one thread scanning the axis in order.
+            template <typename T, typename U, typename COMPARE>
+            void arg_reduction(
+                const T* arg, U* out, const Shape& in_shape, size_t axis, COMPARE better)
+            {
+                size_t outer = 1;
+                for (size_t i = 0; i < axis; i++)
+                {
+                    outer *= in_shape[i];
+                }
+                size_t n = in_shape[axis];
+                size_t inner = 1;
+                for (size_t i = axis + 1; i < in_shape.size(); i++)
+                {
+                    inner *= in_shape[i];
+                }
+                if (outer == 0 || inner == 0)
+                {
+                    return;
+                }
+                if (n == 0)
+                {
+                    std::fill(out, out + outer * inner, U(0));
+                    return;
+                }
+
+                size_t chunk = std::min(inner, reduction_column_chunk);
+                size_t n_chunks = (inner + chunk - 1) / chunk;
+                size_t grain = parallel_grain(n * chunk);
+                parallel_for(outer * n_chunks, grain, [&](size_t begin, size_t end) {
+                    T best[reduction_column_chunk];
+                    for (size_t item = begin; item < end; item++)
+                    {
+                        size_t o = item / n_chunks;
+                        size_t column = item % n_chunks * chunk;
+                        size_t columns = std::min(chunk, inner - column);
+                        const T* in = arg + o * n * inner + column;
+                        U* index = out + o * inner + column;
+                        std::copy(in, in + columns, best);
+                        std::fill(index, index + columns, U(0));
+                        for (size_t i = 1; i < n; i++)
+                        {
+                            const T* x = in + i * inner;
+                            for (size_t j = 0; j < columns; j++)
+                            {
+                                if (better(x[j], best[j]))
+                                {
+                                    best[j] = x[j];
+                                    index[j] = static_cast<U>(i);
+                                }
+                            }
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
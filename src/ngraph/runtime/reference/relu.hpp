@@ -18,6 +18,8 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -28,19 +30,23 @@ namespace ngraph
             void relu(const T* arg, T* out, size_t count)
             {
                 T zero = 0;
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = arg[i] > zero ? arg[i] : zero;
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = arg[i] > zero ? arg[i] : zero;
+                    }
+                });
             }
             template <typename T>
             void relu_backprop(const T* arg, const T* delta_arg, T* out, size_t count)
             {
                 T zero = 0;
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = arg[i] > zero ? delta_arg[i] : zero;
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = arg[i] > zero ? delta_arg[i] : zero;
+                    }
+                });
             }
         }
     }
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_copy.hpp"
 
 namespace ngraph
 {
@@ -35,23 +36,22 @@ namespace ngraph
             {
                 // In fact arg_shape == out_shape, but we'll use both for stylistic consistency with
                 // other kernels.
-                CoordinateTransform arg_transform(arg_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (Coordinate out_coord : output_transform)
+                //
+                // Read arg starting from the last element of every reversed axis, stepping
+                // backwards along them.
+                CopyStrides arg_strides = row_major_copy_strides(arg_shape);
+                std::ptrdiff_t offset = 0;
+                for (size_t axis : reversed_axes)
                 {
-                    Coordinate arg_coord = out_coord;
-
-                    for (size_t i = 0; i < arg_coord.size(); i++)
+                    if (arg_shape[axis] == 0)
                     {
-                        if (reversed_axes.count(i) != 0)
-                        {
-                            arg_coord[i] = arg_shape[i] - arg_coord[i] - 1;
-                        }
+                        return;
                     }
-
-                    out[output_transform.index(out_coord)] = arg[arg_transform.index(arg_coord)];
+                    offset += (arg_shape[axis] - 1) * arg_strides[axis];
+                    arg_strides[axis] = -arg_strides[axis];
                 }
+                strided_copy(
+                    arg + offset, arg_strides, out, row_major_copy_strides(out_shape), out_shape);
             }
         }
     }
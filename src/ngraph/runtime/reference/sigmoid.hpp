@@ -19,6 +19,8 @@
 #include <cmath>
 #include <cstddef>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -28,25 +30,26 @@ namespace ngraph
             template <typename T>
             void sigmoid(const T* arg, T* out, size_t count)
             {
-                T exp_value;
-                for (size_t i = 0; i < count; i++)
-                {
-                    exp_value = std::exp(-arg[i]);
-                    out[i] = 1 / (1 + exp_value);
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        T exp_value = std::exp(-arg[i]);
+                        out[i] = 1 / (1 + exp_value);
+                    }
+                });
             }
 
             template <typename T>
             void sigmoid_backprop(const T* arg, const T* delta_arg, T* out, size_t count)
             {
-                T exp_value;
-                T func_x;
-                for (size_t i = 0; i < count; i++)
-                {
-                    exp_value = std::exp(-arg[i]);
-                    func_x = 1 / (1 + exp_value);
-                    out[i] = delta_arg[i] * func_x * (1 - func_x);
-                }
+                parallel_for(count, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        T exp_value = std::exp(-arg[i]);
+                        T func_x = 1 / (1 + exp_value);
+                        out[i] = delta_arg[i] * func_x * (1 - func_x);
+                    }
+                });
             }
         }
     }
@@ -20,6 +20,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_copy.hpp"
 
 namespace ngraph
 {
@@ -36,22 +37,28 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                // The slice is the block starting at lower_bounds whose axes step strides
+                // elements through arg
+                CopyStrides arg_strides = row_major_copy_strides(arg_shape);
+                Shape slice_shape(arg_shape.size());
+                size_t offset = 0;
+                for (size_t i = 0; i < arg_shape.size(); i++)
                 {
-                    const Coordinate& out_coord = *output_it;
+                    NGRAPH_CHECK(lower_bounds[i] <= upper_bounds[i] &&
+                                 upper_bounds[i] <= arg_shape[i] && strides[i] > 0);
+                    slice_shape[i] = (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) /
+                                     strides[i];
+                    offset += lower_bounds[i] * arg_strides[i];
+                    arg_strides[i] *= strides[i];
+                }
 
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
+                NGRAPH_CHECK(shape_size(slice_shape) == shape_size(out_shape));
 
-                    ++output_it;
-                }
+                strided_copy(arg + offset,
+                             arg_strides,
+                             out,
+                             row_major_copy_strides(slice_shape),
+                             slice_shape);
             }
         }
     }
@@ -17,8 +17,12 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
+
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
+#include "ngraph/runtime/reference/strided_walk.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -28,31 +32,98 @@ namespace ngraph
     {
         namespace reference
         {
+            // Normalizes rows rows of row_size contiguous elements. Each row is finished while it
+            // is still in cache, instead of making a pass over the whole tensor for every step.
+            template <typename T>
+            void softmax_rows(const T* arg, T* out, size_t rows, size_t row_size)
+            {
+                T lowest = std::numeric_limits<T>::has_infinity
+                               ? T(-std::numeric_limits<T>::infinity())
+                               : std::numeric_limits<T>::lowest();
+                auto max_op = [](T a, T x) { return x > a ? x : a; };
+                SumReducer<T> sum_reducer;
+
+                parallel_for(rows, parallel_grain(row_size), [&](size_t begin, size_t end) {
+                    for (size_t row = begin; row < end; row++)
+                    {
+                        const T* x = arg + row * row_size;
+                        T* y = out + row * row_size;
+                        T row_max = reduce_row_in_lanes(x, row_size, lowest, max_op);
+                        for (size_t i = 0; i < row_size; i++)
+                        {
+                            y[i] = std::exp(x[i] - row_max);
+                        }
+                        T row_sum = sum_reducer.reduce_row(y, row_size);
+                        for (size_t i = 0; i < row_size; i++)
+                        {
+                            y[i] = y[i] / row_sum;
+                        }
+                    }
+                });
+            }
+
+            // Returns the number of elements that are normalized together if axes are the
+            // innermost axes of shape, ignoring axes of length 1, and 0 otherwise.
+            inline size_t softmax_row_size(const Shape& shape, const AxisSet& axes)
+            {
+                size_t row_size = 1;
+                bool kept_axis_seen = false;
+                for (size_t axis = shape.size(); axis-- > 0;)
+                {
+                    if (shape[axis] == 1)
+                    {
+                        continue;
+                    }
+                    if (axes.count(axis) == 0)
+                    {
+                        kept_axis_seen = true;
+                    }
+                    else if (kept_axis_seen)
+                    {
+                        return 0;
+                    }
+                    else
+                    {
+                        row_size *= shape[axis];
+                    }
+                }
+                return row_size;
+            }
+
             template <typename T>
             void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
             {
+                size_t size = shape_size(shape);
+                size_t row_size = softmax_row_size(shape, axes);
+                if (row_size != 0)
+                {
+                    if (size != 0)
+                    {
+                        softmax_rows(arg, out, size / row_size, row_size);
+                    }
+                    return;
+                }
+
                 auto temp_shape = reduce(shape, axes);
                 auto temp_elements = shape_size(temp_shape);
                 auto temp_ptr = new T[temp_elements];
 
                 max(arg, temp_ptr, shape, temp_shape, axes);
 
-                CoordinateTransform transform(shape);
-                CoordinateTransform temp_transform(temp_shape);
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = reduce(coord, axes);
-                    out[transform.index(coord)] = std::exp(
-                        arg[transform.index(coord)] - temp_ptr[temp_transform.index(temp_coord)]);
-                }
+                Strides strides = row_major_strides(shape);
+                Strides temp_strides = reduction_strides(shape, axes);
+
+                parallel_strided_walk(
+                    shape, strides, temp_strides, 0, [&](size_t index, size_t temp_index) {
+                        out[index] = std::exp(arg[index] - temp_ptr[temp_index]);
+                    });
 
                 sum(out, temp_ptr, shape, temp_shape, axes);
 
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = reduce(coord, axes);
-                    out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
-                }
+                parallel_strided_walk(
+                    shape, strides, temp_strides, 0, [&](size_t index, size_t temp_index) {
+                        out[index] /= temp_ptr[temp_index];
+                    });
 
                 delete[] temp_ptr;
             }
@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Distances between neighbouring elements along each axis, in elements.
+            /// Negative strides walk an axis backwards.
+            using CopyStrides = std::vector<std::ptrdiff_t>;
+
+            /// \returns The row-major strides of shape as CopyStrides
+            inline CopyStrides row_major_copy_strides(const Shape& shape)
+            {
+                Strides strides = row_major_strides(shape);
+                return CopyStrides(strides.begin(), strides.end());
+            }
+
+            // Copies one row of the innermost axis
+            template <typename T>
+            void strided_copy_row(const T* in,
+                                  std::ptrdiff_t in_stride,
+                                  T* out,
+                                  std::ptrdiff_t out_stride,
+                                  size_t count)
+            {
+                std::ptrdiff_t n = count;
+                if (in_stride == 1 && out_stride == 1)
+                {
+                    std::memcpy(out, in, count * sizeof(T));
+                }
+                else if (in_stride == -1 && out_stride == 1)
+                {
+                    for (std::ptrdiff_t i = 0; i < n; i++)
+                    {
+                        out[i] = in[-i];
+                    }
+                }
+                else
+                {
+                    for (std::ptrdiff_t i = 0; i < n; i++)
+                    {
+                        out[i * out_stride] = in[i * in_stride];
+                    }
+                }
+            }
+
+            /// \brief Copies a block of elements of the given shape. The element at coordinate c
+            /// is read from in[sum(c[i] * in_strides[i])] and written to
+            /// out[sum(c[i] * out_strides[i])]. The elements read and written must not overlap.
+            ///
+            /// Axes of size one are dropped and neighbouring axes that are contiguous in both in
+            /// and out are merged, so the innermost axis is as long as possible. Rows of it are
+            /// copied with memcpy where both sides are contiguous and with a gather loop
+            /// otherwise. The block is split into contiguous ranges on the intra-op thread pool.
+            template <typename T>
+            void strided_copy(const T* in,
+                              const CopyStrides& in_strides,
+                              T* out,
+                              const CopyStrides& out_strides,
+                              const Shape& shape)
+            {
+                size_t size = shape_size(shape);
+                if (size == 0)
+                {
+                    return;
+                }
+                Shape block_shape = shape;
+                CopyStrides block_in_strides = in_strides;
+                CopyStrides block_out_strides = out_strides;
+                merge_strided_axes(block_shape,
+                                   std::array<CopyStrides*, 2>{
+                                       {&block_in_strides, &block_out_strides}});
+                if (block_shape.empty())
+                {
+                    *out = *in;
+                    return;
+                }
+
+                size_t inner_axis = block_shape.size() - 1;
+                size_t row_size = block_shape[inner_axis];
+                std::ptrdiff_t inner_in_stride = block_in_strides[inner_axis];
+                std::ptrdiff_t inner_out_stride = block_out_strides[inner_axis];
+
+                parallel_for(size, parallel_elementwise_grain, [&](size_t begin, size_t end) {
+                    StridedCounter<CopyStrides, 2> row(block_shape,
+                                                       {{&block_in_strides, &block_out_strides}},
+                                                       inner_axis,
+                                                       begin / row_size);
+                    size_t column = begin % row_size;
+                    for (size_t i = begin; i < end;)
+                    {
+                        size_t count = std::min(row_size - column, end - i);
+                        std::ptrdiff_t offset = column;
+                        strided_copy_row(in + row[0] + offset * inner_in_stride,
+                                         inner_in_stride,
+                                         out + row[1] + offset * inner_out_stride,
+                                         inner_out_stride,
+                                         count);
+                        i += count;
+                        column = 0;
+                        ++row;
+                    }
+                });
+            }
+        }
+    }
+}
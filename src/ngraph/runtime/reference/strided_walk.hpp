@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Walks every coordinate of shape in row-major order and calls fn(index0, index1),
+            // where index0 and index1 are the coordinate mapped through strides0 and strides1.
+            // The walk is split over split_axis on the intra-op thread pool. Each partition is
+            // a contiguous slice of split_axis walked in row-major order, so as long as split_axis
+            // is not an axis along which several coordinates share an index that fn accumulates
+            // into, every accumulation happens on one thread in the same order as a serial walk.
+            template <typename FUNCTION>
+            void parallel_strided_walk(const Shape& shape,
+                                       const Strides& strides0,
+                                       const Strides& strides1,
+                                       size_t split_axis,
+                                       FUNCTION fn)
+            {
+                size_t size = shape_size(shape);
+                if (size == 0)
+                {
+                    return;
+                }
+                if (shape.empty())
+                {
+                    fn(0, 0);
+                    return;
+                }
+                size_t split_size = shape[split_axis];
+                size_t grain = parallel_grain(size / split_size);
+
+                parallel_for(split_size, grain, [&](size_t begin, size_t end) {
+                    Shape part_shape = shape;
+                    part_shape[split_axis] = end - begin;
+                    Strides part_strides0 = strides0;
+                    Strides part_strides1 = strides1;
+                    merge_strided_axes(part_shape,
+                                       std::array<Strides*, 2>{{&part_strides0, &part_strides1}});
+                    StridedCounter<Strides, 2> counter(
+                        part_shape,
+                        {{&part_strides0, &part_strides1}},
+                        part_shape.size(),
+                        0,
+                        {{begin * strides0[split_axis], begin * strides1[split_axis]}});
+                    size_t part_size = shape_size(part_shape);
+                    for (size_t i = 0; i < part_size; i++)
+                    {
+                        fn(counter[0], counter[1]);
+                        ++counter;
+                    }
+                });
+            }
+
+            // Calls fn(coordinate, index) for every coordinate of an N,C,... tensor, where index is
+            // the row-major index of coordinate. Whole (batch, channel) planes are distributed over
+            // the intra-op thread pool, so fn may only write to elements of the plane it is given.
+            template <typename FUNCTION>
+            void parallel_plane_walk(const Shape& shape, FUNCTION fn)
+            {
+                size_t n_planes = shape[0] * shape[1];
+                Shape plane_shape(shape.begin() + 2, shape.end());
+                size_t plane_size = shape_size(plane_shape);
+                if (n_planes == 0 || plane_size == 0)
+                {
+                    return;
+                }
+                size_t grain = parallel_grain(plane_size);
+
+                parallel_for(n_planes, grain, [&](size_t begin, size_t end) {
+                    CoordinateTransform plane_transform(plane_shape);
+                    Coordinate coordinate(shape.size());
+                    for (size_t plane = begin; plane < end; plane++)
+                    {
+                        coordinate[0] = plane / shape[1];
+                        coordinate[1] = plane % shape[1];
+                        size_t index = plane * plane_size;
+                        for (const Coordinate& plane_coordinate : plane_transform)
+                        {
+                            std::copy(plane_coordinate.begin(),
+                                      plane_coordinate.end(),
+                                      coordinate.begin() + 2);
+                            fn(coordinate, index++);
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <type_traits>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -52,43 +54,76 @@ namespace ngraph
                 return true;
             }
 
+            // Sums contiguous rows pairwise and columns with Kahan summation. Compensation does
+            // not survive infinities, so a column falls back to its plain sum when the
+            // compensated one is not finite.
             template <typename T>
-            void sum(const T* arg,
-                     T* out,
-                     const Shape& in_shape,
-                     const Shape& out_shape,
-                     const AxisSet& reduction_axes)
+            class SumReducer
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
-
-                for (const Coordinate& output_coord : output_transform)
+            public:
+                T reduce_row(const T* in, size_t n) const
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
+                    if (n <= pairwise_base)
+                    {
+                        return reduce_row_in_lanes(in, n, T(0), [](T a, T b) { return a + b; });
+                    }
+                    size_t half = n / 2 / reduction_lanes * reduction_lanes;
+                    return reduce_row(in, half) + reduce_row(in + half, n - half);
                 }
 
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
+                void reduce_columns(
+                    const T* in, size_t rows, size_t columns, size_t stride, T* out) const
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
+                    if (std::is_integral<T>::value)
+                    {
+                        std::fill(out, out + columns, T(0));
+                        for (size_t row = 0; row < rows; row++)
+                        {
+                            const T* x = in + row * stride;
+                            for (size_t column = 0; column < columns; column++)
+                            {
+                                out[column] = out[column] + x[column];
+                            }
+                        }
+                        return;
+                    }
 
-                    if (is_finite(x) && is_finite(z))
+                    T total[reduction_column_chunk];
+                    T compensation[reduction_column_chunk];
+                    T plain[reduction_column_chunk];
+                    std::fill(total, total + columns, T(0));
+                    std::fill(compensation, compensation + columns, T(0));
+                    std::fill(plain, plain + columns, T(0));
+                    for (size_t row = 0; row < rows; row++)
                     {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
+                        const T* x = in + row * stride;
+                        for (size_t column = 0; column < columns; column++)
+                        {
+                            T y = x[column] - compensation[column];
+                            T t = total[column] + y;
+                            compensation[column] = (t - total[column]) - y;
+                            total[column] = t;
+                            plain[column] = plain[column] + x[column];
+                        }
                     }
-                    else
+                    for (size_t column = 0; column < columns; column++)
                     {
-                        z = z + x;
+                        out[column] = is_finite(total[column]) ? total[column] : plain[column];
                     }
                 }
+
+            private:
+                static const size_t pairwise_base = 128;
+            };
+
+            template <typename T>
+            void sum(const T* arg,
+                     T* out,
+                     const Shape& in_shape,
+                     const Shape& out_shape,
+                     const AxisSet& reduction_axes)
+            {
+                reduction(arg, out, in_shape, out_shape, reduction_axes, SumReducer<T>());
             }
         }
     }
@@ -0,0 +1,175 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_vector.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/reference/strided_copy.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Transposes rows x columns blocks, where in walks the rows contiguously and the
+            // columns by in_stride, and out walks the columns contiguously and the rows by
+            // out_stride. Full 8x8 micro tiles go through a local block with fixed trip counts
+            // so the compiler can keep them in registers.
+            template <typename T>
+            void transpose_tile(const T* in,
+                                size_t in_stride,
+                                T* out,
+                                size_t out_stride,
+                                size_t rows,
+                                size_t columns)
+            {
+                static const size_t micro = 8;
+                size_t full_rows = rows - rows % micro;
+                size_t full_columns = columns - columns % micro;
+                for (size_t r = 0; r < full_rows; r += micro)
+                {
+                    for (size_t c = 0; c < full_columns; c += micro)
+                    {
+                        T block[micro][micro];
+                        for (size_t i = 0; i < micro; i++)
+                        {
+                            for (size_t j = 0; j < micro; j++)
+                            {
+                                block[j][i] = in[(c + i) * in_stride + r + j];
+                            }
+                        }
+                        for (size_t j = 0; j < micro; j++)
+                        {
+                            for (size_t i = 0; i < micro; i++)
+                            {
+                                out[(r + j) * out_stride + c + i] = block[j][i];
+                            }
+                        }
+                    }
+                }
+                for (size_t r = 0; r < rows; r++)
+                {
+                    size_t c = r < full_rows ? full_columns : 0;
+                    for (; c < columns; c++)
+                    {
+                        out[r * out_stride + c] = in[c * in_stride + r];
+                    }
+                }
+            }
+
+            /// \brief Writes the elements of arg in the order of the axes of in_shape given by
+            /// axis_order, like numpy.transpose.
+            ///
+            /// Transposes that do not move data are a copy, which is skipped if arg and out are
+            /// the same buffer. Transposes that keep the innermost input axis innermost copy
+            /// whole rows. The rest are cut into tiles of the axis that is innermost in the input
+            /// and the axis that is innermost in the output, which are small enough for both
+            /// sides of a tile to stay in cache. Tiles are distributed over the intra-op thread
+            /// pool.
+            template <typename T>
+            void transpose(const T* arg,
+                           T* out,
+                           const Shape& in_shape,
+                           const AxisVector& axis_order)
+            {
+                NGRAPH_CHECK(axis_order.size() == in_shape.size());
+                size_t size = shape_size(in_shape);
+                if (size == 0)
+                {
+                    return;
+                }
+
+                Shape shape;
+                AxisVector order;
+                simplify_transpose(in_shape, axis_order, shape, order);
+                size_t rank = order.size();
+                if (rank <= 1)
+                {
+                    if (arg != out)
+                    {
+                        strided_copy(arg, CopyStrides{1}, out, CopyStrides{1}, Shape{size});
+                    }
+                    return;
+                }
+
+                Strides in_strides = row_major_strides(shape);
+                Shape out_shape(rank);
+                CopyStrides out_in_strides(rank);
+                for (size_t i = 0; i < rank; i++)
+                {
+                    out_shape[i] = shape[order[i]];
+                    out_in_strides[i] = in_strides[order[i]];
+                }
+                CopyStrides out_strides = row_major_copy_strides(out_shape);
+                if (order.back() == rank - 1)
+                {
+                    strided_copy(arg, out_in_strides, out, out_strides, out_shape);
+                    return;
+                }
+
+                // Tile output axis row_axis, which is contiguous in the input, against the last
+                // output axis, which is contiguous in the output
+                static const size_t tile = 32;
+                size_t row_axis = std::find(order.begin(), order.end(), rank - 1) - order.begin();
+                size_t column_axis = rank - 1;
+                size_t rows = out_shape[row_axis];
+                size_t columns = out_shape[column_axis];
+                size_t row_tiles = (rows + tile - 1) / tile;
+                size_t column_tiles = (columns + tile - 1) / tile;
+                size_t tiles = size / (rows * columns) * row_tiles * column_tiles;
+
+                parallel_for(tiles, parallel_grain(tile * tile), [&](size_t begin, size_t end) {
+                    for (size_t t = begin; t < end; t++)
+                    {
+                        size_t column_tile = t % column_tiles;
+                        size_t row_tile = t / column_tiles % row_tiles;
+                        size_t outer = t / column_tiles / row_tiles;
+                        size_t in_offset = row_tile * tile;
+                        size_t out_offset = row_tile * tile * out_strides[row_axis] +
+                                            column_tile * tile;
+                        in_offset += column_tile * tile * out_in_strides[column_axis];
+                        for (size_t axis = rank - 1; axis-- > 0;)
+                        {
+                            if (axis == row_axis)
+                            {
+                                continue;
+                            }
+                            size_t position = outer % out_shape[axis];
+                            outer /= out_shape[axis];
+                            in_offset += position * out_in_strides[axis];
+                            out_offset += position * out_strides[axis];
+                        }
+                        transpose_tile(arg + in_offset,
+                                       out_in_strides[column_axis],
+                                       out + out_offset,
+                                       out_strides[row_axis],
+                                       std::min(tile, rows - row_tile * tile),
+                                       std::min(tile, columns - column_tile * tile));
+                    }
+                });
+            }
+        }
+    }
+}
@@ -0,0 +1,258 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/task_scheduler.hpp"
+#include "ngraph/util.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+size_t runtime::get_default_inter_op_concurrency()
+{
+    static const char* env = getenv("NGRAPH_INTER_OP_THREADS");
+    return env == nullptr ? 1 : max<size_t>(1, parse_string<size_t>(env));
+}
+
+runtime::TaskGraph::TaskGraph(size_t task_count)
+    : m_successors(task_count)
+    , m_predecessor_count(task_count, 0)
+{
+}
+
+void runtime::TaskGraph::add_dependency(size_t before, size_t after)
+{
+    NGRAPH_CHECK(before < after && after < size(),
+                 "Task dependency ",
+                 before,
+                 " -> ",
+                 after,
+                 " does not point forward");
+    vector<size_t>& successors = m_successors[before];
+    if (find(successors.begin(), successors.end(), after) == successors.end())
+    {
+        successors.push_back(after);
+        m_predecessor_count[after]++;
+    }
+}
+
+runtime::TaskScheduler::TaskScheduler(size_t num_threads)
+{
+    num_threads = max<size_t>(1, num_threads);
+    for (size_t thread_index = 0; thread_index < num_threads; thread_index++)
+    {
+        m_queues.emplace_back(new ReadyQueue());
+    }
+    for (size_t thread_index = 1; thread_index < num_threads; thread_index++)
+    {
+        m_workers.emplace_back(&TaskScheduler::worker_loop, this, thread_index);
+    }
+}
+
+runtime::TaskScheduler::~TaskScheduler()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_work_ready.notify_all();
+    for (thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void runtime::TaskScheduler::run(const TaskGraph& graph, const function<void(size_t)>& fn)
+{
+    size_t task_count = graph.size();
+    if (m_workers.empty() || task_count <= 1)
+    {
+        for (size_t task = 0; task < task_count; task++)
+        {
+            fn(task);
+        }
+        return;
+    }
+
+    lock_guard<mutex> run_lock(m_run_mutex);
+    m_pending_predecessors.reset(new atomic<size_t>[task_count]);
+    for (size_t task = 0; task < task_count; task++)
+    {
+        m_pending_predecessors[task] = graph.get_predecessor_count(task);
+    }
+    m_remaining = task_count;
+    m_failed = false;
+    m_exception = nullptr;
+
+    // Deal the initially ready tasks round robin so every thread starts with work
+    size_t next_queue = 0;
+    for (size_t task = 0; task < task_count; task++)
+    {
+        if (graph.get_predecessor_count(task) == 0)
+        {
+            push_task(next_queue, task);
+            next_queue = (next_queue + 1) % m_queues.size();
+        }
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_graph = &graph;
+        m_fn = &fn;
+        m_active_workers = m_workers.size();
+        m_generation++;
+    }
+    m_work_ready.notify_all();
+
+    run_tasks(0);
+
+    unique_lock<mutex> lock(m_mutex);
+    m_work_done.wait(lock, [this] { return m_active_workers == 0; });
+    m_graph = nullptr;
+    m_fn = nullptr;
+    for (auto& queue : m_queues)
+    {
+        queue->m_tasks.clear();
+    }
+    m_queued = 0;
+    if (m_exception)
+    {
+        rethrow_exception(m_exception);
+    }
+}
+
+void runtime::TaskScheduler::run_tasks(size_t thread_index)
+{
+    while (!m_failed && m_remaining != 0)
+    {
+        size_t task;
+        if (!pop_task(thread_index, task))
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_task_ready.wait(lock,
+                              [this] { return m_queued != 0 || m_remaining == 0 || m_failed; });
+            continue;
+        }
+
+        try
+        {
+            (*m_fn)(task);
+        }
+        catch (...)
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                if (!m_exception)
+                {
+                    m_exception = current_exception();
+                }
+                m_failed = true;
+            }
+            m_task_ready.notify_all();
+            return;
+        }
+
+        for (size_t successor : m_graph->get_successors(task))
+        {
+            if (--m_pending_predecessors[successor] == 0)
+            {
+                push_task(thread_index, successor);
+            }
+        }
+        if (--m_remaining == 0)
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+            }
+            m_task_ready.notify_all();
+        }
+    }
+}
+
+bool runtime::TaskScheduler::pop_task(size_t thread_index, size_t& task)
+{
+    size_t num_threads = m_queues.size();
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        ReadyQueue& queue = *m_queues[(thread_index + i) % num_threads];
+        lock_guard<mutex> lock(queue.m_mutex);
+        if (!queue.m_tasks.empty())
+        {
+            // Our own queue is used as a stack, other queues are stolen from the other end
+            if (i == 0)
+            {
+                task = queue.m_tasks.back();
+                queue.m_tasks.pop_back();
+            }
+            else
+            {
+                task = queue.m_tasks.front();
+                queue.m_tasks.pop_front();
+            }
+            m_queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::TaskScheduler::push_task(size_t thread_index, size_t task)
+{
+    {
+        ReadyQueue& queue = *m_queues[thread_index];
+        lock_guard<mutex> lock(queue.m_mutex);
+        queue.m_tasks.push_back(task);
+    }
+    m_queued++;
+    {
+        // Sleeping threads test m_queued under m_mutex, so taking it here keeps the wakeup
+        // from being lost
+        lock_guard<mutex> lock(m_mutex);
+    }
+    m_task_ready.notify_one();
+}
+
+void runtime::TaskScheduler::worker_loop(size_t thread_index)
+{
+    size_t generation = 0;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_work_ready.wait(lock, [&] { return m_stop || m_generation != generation; });
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        run_tasks(thread_index);
+
+        bool done;
+        {
+            lock_guard<mutex> lock(m_mutex);
+            done = --m_active_workers == 0;
+        }
+        if (done)
+        {
+            m_work_done.notify_one();
+        }
+    }
+}
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class TaskGraph;
+        class TaskScheduler;
+
+        /// \brief The inter-op concurrency executables use unless told otherwise. Taken from
+        /// NGRAPH_INTER_OP_THREADS and defaults to 1, which runs ops one at a time.
+        size_t get_default_inter_op_concurrency();
+    }
+}
+
+/// \brief A set of tasks numbered [0, size()) and the order constraints between them.
+/// Every dependency must point from a lower task number to a higher one, so counting up is
+/// always a valid serial order.
+class ngraph::runtime::TaskGraph
+{
+public:
+    explicit TaskGraph(size_t task_count = 0);
+
+    size_t size() const { return m_successors.size(); }
+    /// \brief Task after may not start before task before has finished. Duplicate
+    /// dependencies are ignored.
+    void add_dependency(size_t before, size_t after);
+
+    const std::vector<size_t>& get_successors(size_t task) const { return m_successors[task]; }
+    size_t get_predecessor_count(size_t task) const { return m_predecessor_count[task]; }
+
+private:
+    std::vector<std::vector<size_t>> m_successors;
+    std::vector<size_t> m_predecessor_count;
+};
+
+/// \brief Runs the tasks of a TaskGraph on a fixed set of threads as soon as their
+/// dependencies are met. The calling thread takes part, so a scheduler of n threads starts
+/// n - 1 workers.
+///
+/// Each thread owns a deque of ready tasks. Tasks made ready by a thread are pushed onto its
+/// own deque and popped from the back, so a chain of ops tends to stay on one core; a thread
+/// that runs dry steals from the front of the other deques.
+class ngraph::runtime::TaskScheduler
+{
+public:
+    explicit TaskScheduler(size_t num_threads);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    size_t get_num_threads() const { return m_queues.size(); }
+    /// \brief Calls fn(task) once for every task of graph and returns when all have finished.
+    /// A scheduler with a single thread runs the tasks in order on the calling thread.
+    /// If a task throws, no further tasks are started and the first exception is rethrown
+    /// once the tasks already running have finished.
+    void run(const TaskGraph& graph, const std::function<void(size_t)>& fn);
+
+private:
+    struct ReadyQueue
+    {
+        std::mutex m_mutex;
+        std::deque<size_t> m_tasks;
+    };
+
+    void worker_loop(size_t thread_index);
+    void run_tasks(size_t thread_index);
+    bool pop_task(size_t thread_index, size_t& task);
+    void push_task(size_t thread_index, size_t task);
+
+    std::vector<std::unique_ptr<ReadyQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+    std::mutex m_run_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_work_ready;
+    std::condition_variable m_work_done;
+    std::condition_variable m_task_ready;
+    const TaskGraph* m_graph = nullptr;
+    const std::function<void(size_t)>* m_fn = nullptr;
+    std::unique_ptr<std::atomic<size_t>[]> m_pending_predecessors;
+    std::atomic<size_t> m_remaining{0};
+    std::atomic<size_t> m_queued{0};
+    std::atomic<bool> m_failed{false};
+    size_t m_generation = 0;
+    size_t m_active_workers = 0;
+    bool m_stop = false;
+    std::exception_ptr m_exception;
+};
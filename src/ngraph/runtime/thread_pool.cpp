@@ -0,0 +1,183 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/util.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    // Set on pool workers while they run a partition and on any thread inside a SerialScope.
+    // Nested parallel_for calls see it and run inline.
+    thread_local bool s_in_serial_region = false;
+
+    size_t get_default_thread_count()
+    {
+        const char* env = getenv("NGRAPH_INTRA_OP_THREADS");
+        if (env != nullptr)
+        {
+            return max<size_t>(1, parse_string<size_t>(env));
+        }
+        return max<size_t>(1, thread::hardware_concurrency());
+    }
+}
+
+void runtime::parallel_for(size_t size, size_t grain, const function<void(size_t, size_t)>& fn)
+{
+    ThreadPool::get_intra_op_pool().parallel_for(size, grain, fn);
+}
+
+runtime::ThreadPool::ThreadPool(size_t num_threads)
+{
+    for (size_t partition = 1; partition < num_threads; partition++)
+    {
+        m_workers.emplace_back(&ThreadPool::worker_loop, this, partition);
+    }
+}
+
+runtime::ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_work_ready.notify_all();
+    for (thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+runtime::ThreadPool& runtime::ThreadPool::get_intra_op_pool()
+{
+    static ThreadPool pool(get_default_thread_count());
+    return pool;
+}
+
+void runtime::ThreadPool::parallel_for(size_t size,
+                                       size_t grain,
+                                       const function<void(size_t, size_t)>& fn)
+{
+    if (size == 0)
+    {
+        return;
+    }
+    grain = max<size_t>(1, grain);
+    size_t partitions = min(get_num_threads(), (size + grain - 1) / grain);
+    if (partitions <= 1 || s_in_serial_region)
+    {
+        fn(0, size);
+        return;
+    }
+    unique_lock<mutex> call_lock(m_call_mutex, try_to_lock);
+    if (!call_lock.owns_lock())
+    {
+        // Another thread is already using the workers
+        fn(0, size);
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_fn = &fn;
+        m_size = size;
+        m_partitions = partitions;
+        m_pending = partitions - 1;
+        m_exception = nullptr;
+        m_generation++;
+    }
+    m_work_ready.notify_all();
+
+    run_partition(0);
+
+    unique_lock<mutex> lock(m_mutex);
+    m_work_done.wait(lock, [this] { return m_pending == 0; });
+    m_fn = nullptr;
+    if (m_exception)
+    {
+        rethrow_exception(m_exception);
+    }
+}
+
+void runtime::ThreadPool::run_partition(size_t partition)
+{
+    size_t begin = m_size * partition / m_partitions;
+    size_t end = m_size * (partition + 1) / m_partitions;
+    bool previous = s_in_serial_region;
+    s_in_serial_region = true;
+    try
+    {
+        (*m_fn)(begin, end);
+    }
+    catch (...)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (!m_exception)
+        {
+            m_exception = current_exception();
+        }
+    }
+    s_in_serial_region = previous;
+}
+
+void runtime::ThreadPool::worker_loop(size_t partition)
+{
+    size_t generation = 0;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_work_ready.wait(lock, [&] { return m_stop || m_generation != generation; });
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+            if (partition >= m_partitions)
+            {
+                continue;
+            }
+        }
+
+        run_partition(partition);
+
+        bool done;
+        {
+            lock_guard<mutex> lock(m_mutex);
+            done = --m_pending == 0;
+        }
+        if (done)
+        {
+            m_work_done.notify_one();
+        }
+    }
+}
+
+runtime::ThreadPool::SerialScope::SerialScope(bool active)
+    : m_previous(s_in_serial_region)
+{
+    s_in_serial_region = m_previous || active;
+}
+
+runtime::ThreadPool::SerialScope::~SerialScope()
+{
+    s_in_serial_region = m_previous;
+}
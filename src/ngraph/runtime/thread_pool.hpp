@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ThreadPool;
+
+        /// \brief Smallest number of elements worth handing to another thread for cheap
+        /// elementwise work.
+        static const size_t parallel_elementwise_grain = 16384;
+
+        /// \brief Grain for parallel_for over items that each touch item_size elements.
+        inline size_t parallel_grain(size_t item_size)
+        {
+            return item_size == 0 ? parallel_elementwise_grain
+                                  : (parallel_elementwise_grain + item_size - 1) / item_size;
+        }
+
+        /// \brief Runs fn(begin, end) over a partition of [0, size) on the shared intra-op
+        /// thread pool. Ranges smaller than grain items are not split. Calls made from inside
+        /// a parallel region, from inside a ThreadPool::SerialScope, or while another thread
+        /// owns the pool run fn(0, size) on the calling thread.
+        void parallel_for(size_t size, size_t grain, const std::function<void(size_t, size_t)>& fn);
+    }
+}
+
+/// \brief A fixed set of worker threads used by the reference kernels to split one op across
+/// cores. The calling thread takes part in every parallel_for, so a pool of n threads starts
+/// n - 1 workers.
+///
+/// [0, size) is always cut into the same contiguous partitions for a given size, grain and
+/// thread count, and partition p is always run by the same thread. Kernels that give every
+/// output element to exactly one partition therefore produce bit-identical results no matter
+/// how many threads are used.
+class ngraph::runtime::ThreadPool
+{
+public:
+    explicit ThreadPool(size_t num_threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// \returns The number of threads, including the calling thread, that share the work.
+    size_t get_num_threads() const { return m_workers.size() + 1; }
+    void parallel_for(size_t size, size_t grain, const std::function<void(size_t, size_t)>& fn);
+
+    /// \brief The pool used by the reference kernels. Its size is taken from
+    /// NGRAPH_INTRA_OP_THREADS and defaults to the number of hardware threads.
+    static ThreadPool& get_intra_op_pool();
+
+    /// \brief While alive and active, parallel_for calls made on this thread run serially.
+    /// Executables that were compiled with intra-op parallelism disabled hold an active one for
+    /// the duration of a call.
+    class SerialScope
+    {
+    public:
+        SerialScope(bool active = true);
+        ~SerialScope();
+
+        SerialScope(const SerialScope&) = delete;
+        SerialScope& operator=(const SerialScope&) = delete;
+
+    private:
+        bool m_previous;
+    };
+
+private:
+    void worker_loop(size_t partition);
+    void run_partition(size_t partition);
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_call_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_work_ready;
+    std::condition_variable m_work_done;
+    const std::function<void(size_t, size_t)>* m_fn = nullptr;
+    size_t m_size = 0;
+    size_t m_partitions = 0;
+    size_t m_generation = 0;
+    size_t m_pending = 0;
+    bool m_stop = false;
+    std::exception_ptr m_exception;
+};
@@ -14,9 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <queue>
+#include <set>
+#include <sstream>
 #include <stack>
 
 #include "ngraph/cpio.hpp"
@@ -160,13 +164,14 @@
 #include "ngraph/op/xor.hpp"
 #include "ngraph/provenance.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/sha256.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 
 using namespace ngraph;
 using namespace std;
 using json = nlohmann::json;
-using const_data_callback_t = shared_ptr<Node>(const string&, const element::Type&, const Shape&);
+using const_data_callback_t = shared_ptr<Node>(const json&, const element::Type&, const Shape&);
 
 static bool s_serialize_output_shapes_enabled =
     (std::getenv("NGRAPH_SERIALIZER_OUTPUT_SHAPES") != nullptr);
@@ -181,6 +186,29 @@ bool ngraph::get_serialize_output_shapes()
     return s_serialize_output_shapes_enabled;
 }
 
+namespace
+{
+    // A binary model starts with this header, in host byte order. The model itself is stored
+    // as json, with every constant written as an offset into the data section. The data
+    // section starts on a page boundary and each constant on a 64 byte boundary, so the
+    // constants of a mapped model can use the mapped data in place.
+    struct BinaryModelHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t model_offset;
+        uint64_t model_size;
+        uint64_t data_offset;
+        uint64_t data_size;
+    };
+
+    const char s_binary_model_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'B', 'M'};
+    const uint32_t s_binary_model_version = 1;
+    const size_t s_binary_data_alignment = 4096;
+    const size_t s_binary_constant_alignment = 64;
+}
+
 // This expands the op list in op_tbl.hpp into a list of enumerations that look like this:
 // Abs,
 // Acos,
@@ -215,17 +243,54 @@ static OP_TYPEID get_typeid(const string& s)
     return rc;
 }
 
-bool has_key(json j, const std::string& key)
+bool has_key(const json& j, const std::string& key)
 {
     return j.count(key) != 0;
 }
 
 template <typename T>
-T get_or_default(json j, const std::string& key, const T& default_value)
+T get_or_default(const json& j, const std::string& key, const T& default_value)
 {
     return has_key(j, key) ? j.at(key).get<T>() : default_value;
 }
 
+namespace
+{
+    // Drops what serialize_node writes about a node's identity and connections, leaving the
+    // op and its attributes
+    void erase_node_connections(json& node_js)
+    {
+        for (const char* key : {"name",
+                                "friendly_name",
+                                "inputs",
+                                "control_deps",
+                                "outputs",
+                                "output_shapes",
+                                "provenance_tags"})
+        {
+            node_js.erase(key);
+        }
+    }
+
+    // False if serialize_node leaves out attributes of the node's op, so that what it writes
+    // can not tell such nodes apart. It writes nothing but the connections of ops it does not
+    // know, and none of the attributes of the ops listed here.
+    bool serializes_all_attributes(const Node& node)
+    {
+        static const set<OP_TYPEID> dropped_attributes{
+            OP_TYPEID::AllReduce,
+            OP_TYPEID::BroadcastDistributed,
+            OP_TYPEID::DynPad,
+            OP_TYPEID::QuantizedConvolutionBias,
+            OP_TYPEID::QuantizedConvolutionBiasAdd,
+            OP_TYPEID::QuantizedConvolutionBiasSignedAdd,
+            OP_TYPEID::QuantizedConvolutionRelu,
+            OP_TYPEID::QuantizedDotBias,
+            OP_TYPEID::UnknownOp};
+        return dropped_attributes.count(get_typeid(node.description())) == 0;
+    }
+}
+
 class JSONSerializer
 {
 public:
@@ -240,7 +305,16 @@ public:
         m_binary_constant_data = binary_constant_data;
     }
 
+    // With binary constant data, constants are written as a "data_offset" into a data section
+    // instead of as value strings. These are the constants at each offset.
+    const vector<pair<size_t, const op::Constant*>>& get_binary_constants() const
+    {
+        return m_binary_constants;
+    }
+    size_t get_binary_constant_data_size() const { return m_binary_constant_data_size; }
+
     json serialize_function(const Function& function);
+    string digest_function(const Function& function);
     json serialize_output(const Output<Node>& output);
     json serialize_parameter_vector(const ParameterVector& parameters);
     json serialize_output_vector(const OutputVector& output_vector);
@@ -256,6 +330,8 @@ protected:
     size_t m_indent{0};
     bool m_serialize_output_shapes{false};
     bool m_binary_constant_data{false};
+    vector<pair<size_t, const op::Constant*>> m_binary_constants;
+    size_t m_binary_constant_data_size{0};
     json m_json_nodes;
     set<const Node*> m_nodes_serialized;
     queue<const Node*> m_nodes_to_serialize;
@@ -269,17 +345,17 @@ public:
         m_const_data_callback = const_data_callback;
     }
 
-    shared_ptr<Function> deserialize_function(json j);
-    Output<Node> deserialize_output(json j);
-    OutputVector deserialize_output_vector(json j);
-    ParameterVector deserialize_parameter_vector(json j);
-    shared_ptr<Node> deserialize_node_reference(json j);
-    shared_ptr<Node> deserialize_node(json j);
-    AxisSet deserialize_axis_set(json j);
+    shared_ptr<Function> deserialize_function(const json& j);
+    Output<Node> deserialize_output(const json& j);
+    OutputVector deserialize_output_vector(const json& j);
+    ParameterVector deserialize_parameter_vector(const json& j);
+    shared_ptr<Node> deserialize_node_reference(const json& j);
+    shared_ptr<Node> deserialize_node(const json& j);
+    AxisSet deserialize_axis_set(const json& j);
     shared_ptr<op::TensorIterator::InputDescription>
-        deserialize_tensor_iterator_input_description(json j);
+        deserialize_tensor_iterator_input_description(const json& j);
     shared_ptr<op::TensorIterator::OutputDescription>
-        deserialize_tensor_iterator_output_description(json j);
+        deserialize_tensor_iterator_output_description(const json& j);
 
 protected:
     unordered_map<string, shared_ptr<Node>> m_node_map;
@@ -287,6 +363,141 @@ protected:
     function<const_data_callback_t> m_const_data_callback;
 };
 
+// Receives the events of json::sax_parse and builds the json values as usual, except for the
+// ops of each function. An op is deserialized as soon as it has been read and its json is then
+// dropped, so the json of a whole model is never held at once.
+class JSONStreamDeserializer
+{
+public:
+    JSONStreamDeserializer(JSONDeserializer& deserializer)
+        : m_deserializer(deserializer)
+    {
+    }
+
+    // The last function of the model
+    shared_ptr<Function> get_function() const { return m_function; }
+    bool null()
+    {
+        add(nullptr);
+        return true;
+    }
+    bool boolean(bool value)
+    {
+        add(value);
+        return true;
+    }
+    bool number_integer(json::number_integer_t value)
+    {
+        add(value);
+        return true;
+    }
+    bool number_unsigned(json::number_unsigned_t value)
+    {
+        add(value);
+        return true;
+    }
+    bool number_float(json::number_float_t value, const json::string_t&)
+    {
+        add(value);
+        return true;
+    }
+    bool string(json::string_t& value)
+    {
+        add(move(value));
+        return true;
+    }
+    // Only called for binary formats, never for json text
+    template <typename Binary>
+    bool binary(Binary&)
+    {
+        return false;
+    }
+    bool key(json::string_t& key)
+    {
+        m_key = move(key);
+        return true;
+    }
+    bool start_object(size_t)
+    {
+        m_stack.push_back(add(json::object()));
+        return true;
+    }
+    bool end_object()
+    {
+        json* object = m_stack.back();
+        m_stack.pop_back();
+        if (m_stack.size() == 3 && m_stack.back() == m_ops)
+        {
+            m_deserializer.deserialize_node(*object);
+            m_ops->get_ref<json::array_t&>().pop_back();
+        }
+        else if (m_stack.size() == 1 && m_stack.back()->is_array())
+        {
+            // A function, all of whose ops have been deserialized already
+            m_function = m_deserializer.deserialize_function(*object);
+            m_stack.back()->get_ref<json::array_t&>().pop_back();
+            m_ops = nullptr;
+        }
+        return true;
+    }
+    bool start_array(size_t)
+    {
+        json* array = add(json::array());
+        if (m_stack.size() == 2 && m_key == "ops")
+        {
+            m_ops = array;
+        }
+        m_stack.push_back(array);
+        return true;
+    }
+    bool end_array()
+    {
+        m_stack.pop_back();
+        return true;
+    }
+    template <typename Exception>
+    bool parse_error(size_t, const std::string&, const Exception& e)
+    {
+        throw e;
+    }
+
+private:
+    // Adds value to the innermost open array or object, or makes it the root
+    json* add(json&& value)
+    {
+        if (m_stack.empty())
+        {
+            m_root = move(value);
+            return &m_root;
+        }
+        json& parent = *m_stack.back();
+        if (parent.is_array())
+        {
+            parent.push_back(move(value));
+            return &parent.back();
+        }
+        json& member = parent[m_key];
+        member = move(value);
+        return &member;
+    }
+
+    JSONDeserializer& m_deserializer;
+    json m_root;
+    vector<json*> m_stack;
+    json* m_ops = nullptr;
+    std::string m_key;
+    shared_ptr<Function> m_function;
+};
+
+// Deserializes the json model read from input, which is anything json::sax_parse reads
+template <typename... Input>
+static shared_ptr<Function> stream_deserialize(JSONDeserializer& deserializer, Input&&... input)
+{
+    JSONStreamDeserializer stream_deserializer(deserializer);
+    json::sax_parse(std::forward<Input>(input)..., &stream_deserializer);
+    return stream_deserializer.get_function();
+}
+
 static string
     serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
 
@@ -302,7 +513,7 @@ static json write_dimension(Dimension d)
     }
 }
 
-static Dimension read_dimension(json j)
+static Dimension read_dimension(const json& j)
 {
     if (j.is_null())
     {
@@ -331,7 +542,7 @@ static json write_partial_shape(const PartialShape& s)
     }
 }
 
-static PartialShape read_partial_shape(json j)
+static PartialShape read_partial_shape(const json& j)
 {
     if (j.is_null())
     {
@@ -357,13 +568,13 @@ static json write_auto_broadcast(const op::AutoBroadcastSpec& autob)
 }
 
 static op::AutoBroadcastSpec
-    read_auto_broadcast(json js_node,
+    read_auto_broadcast(const json& js_node,
                         const std::string& attr,
                         const op::AutoBroadcastSpec& autob = op::AutoBroadcastSpec())
 {
     if (has_key(js_node, attr))
     {
-        json j = js_node[attr];
+        const json& j = js_node.at(attr);
         return op::AutoBroadcastSpec(static_cast<op::AutoBroadcastType>(j.at("type")),
                                      j.at("axis").get<int64_t>());
     }
@@ -373,19 +584,19 @@ static op::AutoBroadcastSpec
     }
 }
 
-static op::PadType read_pad_type(json node_js)
+static op::PadType read_pad_type(const json& node_js)
 {
     return has_key(node_js, "pad_type") ? static_cast<op::PadType>(node_js.at("pad_type"))
                                         : op::PadType::EXPLICIT;
 }
 
-static op::PadMode read_pad_mode(json node_js)
+static op::PadMode read_pad_mode(const json& node_js)
 {
     return has_key(node_js, "pad_mode") ? static_cast<op::PadMode>(node_js.at("pad_mode"))
                                         : op::PadMode::CONSTANT;
 }
 
-static op::RoundingType read_rounding_type(json node_js)
+static op::RoundingType read_rounding_type(const json& node_js)
 {
     return has_key(node_js, "rounding_type")
                ? static_cast<op::RoundingType>(node_js.at("rounding_type"))
@@ -399,7 +610,7 @@ static json write_element_type(const ngraph::element::Type& n)
     return j;
 }
 
-static element::Type read_element_type(json j)
+static element::Type read_element_type(const json& j)
 {
     size_t bitwidth = 0;
     bool is_real = false;
@@ -472,6 +683,98 @@ static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, s
 }
 #endif
 
+void ngraph::serialize_binary(const string& path, shared_ptr<ngraph::Function> func)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_binary(out, func);
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<ngraph::Function> func)
+{
+    JSONSerializer serializer;
+    serializer.set_binary_constant_data(true);
+    serializer.set_serialize_output_shapes(s_serialize_output_shapes_enabled);
+    json j;
+    j.push_back(serializer.serialize_function(*func));
+    string model = j.dump();
+
+    BinaryModelHeader header{};
+    memcpy(header.magic, s_binary_model_magic, sizeof(header.magic));
+    header.version = s_binary_model_version;
+    header.model_offset = sizeof(header);
+    header.model_size = model.size();
+    header.data_offset = round_up(sizeof(header) + model.size(), s_binary_data_alignment);
+    header.data_size = serializer.get_binary_constant_data_size();
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(model.data(), model.size());
+    size_t position = sizeof(header) + model.size();
+    auto pad_to = [&](size_t offset) {
+        string padding(offset - position, '\0');
+        out.write(padding.data(), padding.size());
+        position = offset;
+    };
+    pad_to(header.data_offset);
+    for (auto& offset_constant : serializer.get_binary_constants())
+    {
+        const op::Constant* constant = offset_constant.second;
+        size_t size = shape_size(constant->get_shape()) * constant->get_element_type().size();
+        pad_to(header.data_offset + offset_constant.first);
+        out.write(static_cast<const char*>(constant->get_data_ptr()), size);
+        position += size;
+    }
+}
+
+static bool is_binary_model(istream& in)
+{
+    char magic[sizeof(s_binary_model_magic)];
+    auto position = in.tellg();
+    in.read(magic, sizeof(magic));
+    bool rc = in.gcount() == sizeof(magic) &&
+              memcmp(magic, s_binary_model_magic, sizeof(magic)) == 0;
+    in.clear();
+    in.seekg(position);
+    return rc;
+}
+
+// Constants are made over the model data in place, each one keeping all of data alive
+static shared_ptr<Function> deserialize_binary(const shared_ptr<char>& data, size_t size)
+{
+    BinaryModelHeader header;
+    if (size < sizeof(header))
+    {
+        throw ngraph_error("Binary model is truncated");
+    }
+    memcpy(&header, data.get(), sizeof(header));
+    if (header.version != s_binary_model_version)
+    {
+        throw ngraph_error("Unsupported binary model version " + to_string(header.version));
+    }
+    if (header.model_offset + header.model_size > size ||
+        header.data_offset + header.data_size > size)
+    {
+        throw ngraph_error("Binary model is truncated");
+    }
+
+    const char* model = data.get() + header.model_offset;
+    char* constant_data = data.get() + header.data_offset;
+    JSONDeserializer deserializer;
+    deserializer.set_const_data_callback(
+        [&](const json& node_js, const element::Type& et, const Shape& shape) {
+            size_t offset = node_js.at("data_offset").get<size_t>();
+            size_t byte_size = shape_size(shape) * et.size();
+            if (offset + byte_size > header.data_size)
+            {
+                throw ngraph_error("Constant data is outside of the binary model");
+            }
+            shared_ptr<runtime::AlignedBuffer> buffer(
+                new runtime::AlignedBuffer(constant_data + offset, byte_size),
+                [data](runtime::AlignedBuffer* p) { delete p; });
+            return make_shared<op::Constant>(et, shape, buffer);
+        });
+    return stream_deserialize(deserializer, model, model + header.model_size);
+}
+
 static string serialize(shared_ptr<Function> func, size_t indent, bool binary_constant_data)
 {
     JSONSerializer serializer;
@@ -499,10 +802,40 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+string ngraph::hash_function(shared_ptr<Function> func)
+{
+    JSONSerializer serializer;
+    return serializer.digest_function(*func);
+}
+
+string ngraph::serialize_node_attributes(const Node& node)
+{
+    if (!serializes_all_attributes(node))
+    {
+        return "";
+    }
+    JSONSerializer serializer;
+    json node_js = serializer.serialize_node(node);
+    erase_node_connections(node_js);
+    return node_js.dump();
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    if (is_binary_model(in))
+    {
+        // A stream can not be mapped, so the model is read into memory
+        auto start = in.tellg();
+        in.seekg(0, ios_base::end);
+        size_t size = static_cast<size_t>(in.tellg() - start);
+        in.seekg(start);
+        auto buffer = make_shared<runtime::AlignedBuffer>(size, s_binary_data_alignment);
+        in.read(static_cast<char*>(buffer->get_ptr()), size);
+        rc = deserialize_binary(shared_ptr<char>(buffer, static_cast<char*>(buffer->get_ptr())),
+                                size);
+    }
+    else if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
         vector<cpio::FileInfo> file_info = reader.get_file_info();
@@ -514,10 +847,10 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
             reader.read(file_info[0].get_name(), data, size);
             string jstr(data, size);
             delete[] data;
-            json js = json::parse(jstr);
             JSONDeserializer deserializer;
             deserializer.set_const_data_callback(
-                [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                [&](const json& node_js, const element::Type& et, const Shape& shape) {
+                    string const_name = node_js.at("name").get<string>();
                     shared_ptr<Node> const_node;
                     for (const cpio::FileInfo& info : file_info)
                     {
@@ -532,18 +865,14 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
                     }
                     return const_node;
                 });
-            for (json func : js)
-            {
-                rc = deserializer.deserialize_function(func);
-            }
+            rc = stream_deserialize(deserializer, jstr);
         }
     }
     else
     {
         // json file?
-        std::stringstream ss;
-        ss << in.rdbuf();
-        rc = deserialize(ss.str());
+        JSONDeserializer deserializer;
+        rc = stream_deserialize(deserializer, in);
     }
     return rc;
 }
@@ -555,16 +884,25 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     {
         // s is a file and not a json string
         ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        size_t size = 0;
+        shared_ptr<char> data;
+        if (is_binary_model(in))
+        {
+            data = file_util::map_file(s, size);
+        }
+        if (data)
+        {
+            rc = deserialize_binary(data, size);
+        }
+        else
+        {
+            rc = deserialize(in);
+        }
     }
     else
     {
-        json js = json::parse(s);
         JSONDeserializer deserializer;
-        for (json func : js)
-        {
-            rc = deserializer.deserialize_function(func);
-        }
+        rc = stream_deserialize(deserializer, s);
     }
     return rc;
 }
@@ -594,8 +932,75 @@ json JSONSerializer::serialize_function(const Function& f)
     return function;
 }
 
+string JSONSerializer::digest_function(const Function& f)
+{
+    SHA256 digest;
+    unordered_map<const Node*, uint64_t> node_index;
+    for (const shared_ptr<Node>& node : f.get_ordered_ops())
+    {
+        if (!serializes_all_attributes(*node))
+        {
+            return "";
+        }
+
+        // Other ops are referred to by their position in the topological order
+        digest.update(static_cast<uint64_t>(node->get_input_size()));
+        for (auto input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            digest.update(node_index.at(source.get_node()));
+            digest.update(static_cast<uint64_t>(source.get_index()));
+        }
+        vector<uint64_t> control_indices;
+        for (auto& control : node->get_control_dependencies())
+        {
+            auto it = node_index.find(control.get());
+            if (it != node_index.end())
+            {
+                control_indices.push_back(it->second);
+            }
+        }
+        digest.update(static_cast<uint64_t>(control_indices.size()));
+        for (uint64_t index : control_indices)
+        {
+            digest.update(index);
+        }
+        for (auto& output : node->outputs())
+        {
+            stringstream ss;
+            ss << output.get_element_type() << output.get_partial_shape();
+            digest.update(ss.str());
+        }
+
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            // The data is hashed once per constant rather than in its much larger string form
+            m_nodes_serialized.insert(node.get());
+            digest.update(node->description());
+            digest.update(constant->get_data_digest());
+        }
+        else
+        {
+            json node_js = serialize_node(*node);
+            erase_node_connections(node_js);
+            digest.update(node_js.dump());
+        }
+        node_index.insert({node.get(), node_index.size()});
+    }
+
+    for (auto& parameter : f.get_parameters())
+    {
+        digest.update(node_index.at(parameter.get()));
+    }
+    for (auto& result : f.get_results())
+    {
+        digest.update(node_index.at(result.get()));
+    }
+    return digest.get_hex();
+}
+
 template <typename T>
-T get_value(json js, const string& key)
+T get_value(const json& js, const string& key)
 {
     T rc = {};
     auto it = js.find(key);
@@ -606,39 +1011,39 @@ T get_value(json js, const string& key)
     return rc;
 }
 
-shared_ptr<Node> JSONDeserializer::deserialize_node_reference(json j)
+shared_ptr<Node> JSONDeserializer::deserialize_node_reference(const json& j)
 {
     const string& name = j;
     return m_node_map.at(name);
 }
 
-Output<Node> JSONDeserializer::deserialize_output(json j)
+Output<Node> JSONDeserializer::deserialize_output(const json& j)
 {
     size_t index;
-    json json_node_reference;
+    const json* json_node_reference;
     if (j.is_string())
     {
-        json_node_reference = j;
+        json_node_reference = &j;
         index = 0;
     }
     else if (j.is_object())
     {
-        json_node_reference = j["node"];
-        index = j["index"];
+        json_node_reference = &j.at("node");
+        index = j.at("index");
     }
     else
     {
         throw ngraph_error("Expected string or object an output while deserializing");
     }
-    return Output<Node>(deserialize_node_reference(json_node_reference), index);
+    return Output<Node>(deserialize_node_reference(*json_node_reference), index);
 }
 
-OutputVector JSONDeserializer::deserialize_output_vector(json j)
+OutputVector JSONDeserializer::deserialize_output_vector(const json& j)
 {
     OutputVector result;
     if (j.is_array())
     {
-        for (json jelt : j)
+        for (const json& jelt : j)
         {
             result.push_back(deserialize_output(jelt));
         }
@@ -651,7 +1056,7 @@ json JSONSerializer::serialize_axis_set(const AxisSet& axis_set)
     return static_cast<set<size_t>>(axis_set);
 }
 
-AxisSet JSONDeserializer::deserialize_axis_set(json j)
+AxisSet JSONDeserializer::deserialize_axis_set(const json& j)
 {
     AxisSet result;
     if (j.is_array())
@@ -699,34 +1104,34 @@ json JSONSerializer::serialize_tensor_iterator_input_description(
 }
 
 shared_ptr<op::TensorIterator::InputDescription>
-    JSONDeserializer::deserialize_tensor_iterator_input_description(json j)
+    JSONDeserializer::deserialize_tensor_iterator_input_description(const json& j)
 {
-    string kind = j["kind"];
+    string kind = j.at("kind");
     shared_ptr<op::TensorIterator::InputDescription> result;
     if (kind == "slice")
     {
-        uint64_t input_index = j["input_index"].get<uint64_t>();
-        uint64_t body_parameter_index = j["body_parameter_index"].get<uint64_t>();
-        int64_t start = j["start"].get<int64_t>();
-        int64_t stride = j["stride"].get<int64_t>();
-        uint64_t part_size = j["part_size"].get<int64_t>();
-        int64_t end = j["end"].get<int64_t>();
-        int64_t axis = j["axis"].get<int64_t>();
+        uint64_t input_index = j.at("input_index").get<uint64_t>();
+        uint64_t body_parameter_index = j.at("body_parameter_index").get<uint64_t>();
+        int64_t start = j.at("start").get<int64_t>();
+        int64_t stride = j.at("stride").get<int64_t>();
+        uint64_t part_size = j.at("part_size").get<int64_t>();
+        int64_t end = j.at("end").get<int64_t>();
+        int64_t axis = j.at("axis").get<int64_t>();
         result = make_shared<op::TensorIterator::SliceInputDescription>(
             input_index, body_parameter_index, start, stride, part_size, end, axis);
     }
     else if (kind == "merged")
     {
-        uint64_t input_index = j["input_index"].get<uint64_t>();
-        uint64_t body_parameter_index = j["body_parameter_index"].get<uint64_t>();
-        uint64_t body_value_index = j["body_value_index"].get<uint64_t>();
+        uint64_t input_index = j.at("input_index").get<uint64_t>();
+        uint64_t body_parameter_index = j.at("body_parameter_index").get<uint64_t>();
+        uint64_t body_value_index = j.at("body_value_index").get<uint64_t>();
         result = make_shared<op::TensorIterator::MergedInputDescription>(
             input_index, body_parameter_index, body_value_index);
     }
     else if (kind == "constant")
     {
-        uint64_t input_index = j["input_index"].get<uint64_t>();
-        uint64_t body_parameter_index = j["body_parameter_index"].get<uint64_t>();
+        uint64_t input_index = j.at("input_index").get<uint64_t>();
+        uint64_t body_parameter_index = j.at("body_parameter_index").get<uint64_t>();
         result = make_shared<op::TensorIterator::InvariantInputDescription>(input_index,
                                                                             body_parameter_index);
     }
@@ -768,27 +1173,27 @@ json JSONSerializer::serialize_tensor_iterator_output_description(
 }
 
 std::shared_ptr<op::TensorIterator::OutputDescription>
-    JSONDeserializer::deserialize_tensor_iterator_output_description(json j)
+    JSONDeserializer::deserialize_tensor_iterator_output_description(const json& j)
 {
-    string kind = j["kind"];
+    string kind = j.at("kind");
     shared_ptr<op::TensorIterator::OutputDescription> result;
     if (kind == "concat")
     {
-        uint64_t body_value_index = j["body_value_index"].get<uint64_t>();
-        uint64_t output_index = j["output_index"].get<uint64_t>();
-        int64_t start = j["start"].get<int64_t>();
-        int64_t stride = j["stride"].get<int64_t>();
-        uint64_t part_size = j["part_size"].get<int64_t>();
-        int64_t end = j["end"].get<int64_t>();
-        int64_t axis = j["axis"].get<int64_t>();
+        uint64_t body_value_index = j.at("body_value_index").get<uint64_t>();
+        uint64_t output_index = j.at("output_index").get<uint64_t>();
+        int64_t start = j.at("start").get<int64_t>();
+        int64_t stride = j.at("stride").get<int64_t>();
+        uint64_t part_size = j.at("part_size").get<int64_t>();
+        int64_t end = j.at("end").get<int64_t>();
+        int64_t axis = j.at("axis").get<int64_t>();
         result = make_shared<op::TensorIterator::ConcatOutputDescription>(
             body_value_index, output_index, start, stride, part_size, end, axis);
     }
     else if (kind == "body_output")
     {
-        uint64_t body_value_index = j["body_value_index"].get<uint64_t>();
-        uint64_t output_index = j["output_index"].get<uint64_t>();
-        int64_t iteration = j["iteration"].get<int64_t>();
+        uint64_t body_value_index = j.at("body_value_index").get<uint64_t>();
+        uint64_t output_index = j.at("output_index").get<uint64_t>();
+        int64_t iteration = j.at("iteration").get<int64_t>();
         result = make_shared<op::TensorIterator::BodyOutputDescription>(
             body_value_index, output_index, iteration);
     }
@@ -799,7 +1204,7 @@ std::shared_ptr<op::TensorIterator::OutputDescription>
     return result;
 }
 
-ParameterVector JSONDeserializer::deserialize_parameter_vector(json json_parameters)
+ParameterVector JSONDeserializer::deserialize_parameter_vector(const json& json_parameters)
 {
     std::vector<std::shared_ptr<op::Parameter>> params;
     for (auto& param_ref : json_parameters)
@@ -809,11 +1214,11 @@ ParameterVector JSONDeserializer::deserialize_parameter_vector(json json_paramet
     return params;
 }
 
-shared_ptr<Function> JSONDeserializer::deserialize_function(json func_js)
+shared_ptr<Function> JSONDeserializer::deserialize_function(const json& func_js)
 {
     string func_name = func_js.at("name").get<string>();
-    vector<json> func_result = func_js.at("result");
-    for (json node_js : func_js.at("ops"))
+    const json& func_result = func_js.at("result");
+    for (const json& node_js : func_js.at("ops"))
     {
         deserialize_node(node_js);
     }
@@ -891,7 +1296,7 @@ struct OutputVectorHelper
     OutputVector m_vector;
 };
 
-shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
+shared_ptr<Node> JSONDeserializer::deserialize_node(const json& node_js)
 {
     shared_ptr<Node> node;
     try
@@ -902,7 +1307,9 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         size_t op_version = get_value<size_t>(node_js, "op_version");
         vector<json> control_deps_inputs = get_value<vector<json>>(node_js, "control_deps");
         vector<string> node_outputs = get_value<vector<string>>(node_js, "outputs");
-        OutputVectorHelper args(deserialize_output_vector(node_js["inputs"]));
+        auto inputs = node_js.find("inputs");
+        OutputVectorHelper args(inputs == node_js.end() ? OutputVector{}
+                                                        : deserialize_output_vector(*inputs));
 
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
 #pragma GCC diagnostic push
@@ -1167,6 +1574,11 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
+            if (m_const_data_callback && !has_key(node_js, "value"))
+            {
+                node = m_const_data_callback(node_js, element_type, shape);
+                break;
+            }
             auto value = node_js.at("value").get<vector<string>>();
             node = make_shared<op::Constant>(element_type, shape, value);
             break;
@@ -1193,11 +1605,11 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 json data_dilation_strides;
                 if (has_key(node_js, "data_dilation_strides"))
                 {
-                    data_dilation_strides = node_js["data_dilation_strides"];
+                    data_dilation_strides = node_js.at("data_dilation_strides");
                 }
                 else if (has_key(node_js, "image_dilation_strides"))
                 {
-                    data_dilation_strides = node_js["image_dilation_strides"];
+                    data_dilation_strides = node_js.at("image_dilation_strides");
                 }
 
                 op::PadType pad_type = read_pad_type(node_js);
@@ -1424,7 +1836,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             // For backwards compatibility, reduction_axes_count is optional.
             if (has_key(node_js, "reduction_axes_count"))
             {
-                size_t reduction_axes_count = node_js["reduction_axes_count"].get<size_t>();
+                size_t reduction_axes_count = node_js.at("reduction_axes_count").get<size_t>();
                 node = make_shared<op::Dot>(args[0], args[1], reduction_axes_count);
             }
             else
@@ -2266,7 +2678,10 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         {
             if (op_version == 0)
             {
-                auto reduction_axes = deserialize_axis_set(node_js.at("reduction_axes"));
+                // Axes given as an input are not written as an attribute
+                auto reduction_axes = has_key(node_js, "reduction_axes")
+                                          ? deserialize_axis_set(node_js.at("reduction_axes"))
+                                          : AxisSet{};
                 if (reduction_axes.empty())
                     node = make_shared<op::v0::Product>(args[0], args[1]);
                 else
@@ -2303,7 +2718,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 node_js.at("window_dilation_strides").get<vector<size_t>>();
             auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
             auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
-            auto data_dilation_strides = node_js["data_dilation_strides"];
+            auto data_dilation_strides = node_js.at("data_dilation_strides");
             auto output_type = read_element_type(node_js.at("output_type"));
             auto input_axes = node_js.at("input_axes").get<set<size_t>>();
             auto filter_axes = node_js.at("filter_axes").get<set<size_t>>();
@@ -2333,7 +2748,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         }
         case OP_TYPEID::QuantizedDot:
         {
-            size_t reduction_axes_count = node_js["reduction_axes_count"].get<size_t>();
+            size_t reduction_axes_count = node_js.at("reduction_axes_count").get<size_t>();
             auto output_type = read_element_type(node_js.at("output_type"));
             auto input0_axes = node_js.at("input0_axes").get<set<size_t>>();
             auto input1_axes = node_js.at("input1_axes").get<set<size_t>>();
@@ -2623,7 +3038,10 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         {
             if (op_version == 0)
             {
-                auto reduction_axes = deserialize_axis_set(node_js.at("reduction_axes"));
+                // Axes given as an input are not written as an attribute
+                auto reduction_axes = has_key(node_js, "reduction_axes")
+                                          ? deserialize_axis_set(node_js.at("reduction_axes"))
+                                          : AxisSet{};
                 if (reduction_axes.empty())
                     node = make_shared<op::v0::Sum>(args[0], args[1]);
                 else
@@ -2649,37 +3067,37 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         case OP_TYPEID::TensorIterator:
         {
             auto ti = make_shared<op::TensorIterator>(args);
-            json jbody = node_js["body"];
+            const json& jbody = node_js.at("body");
             // Serializer assumes inputs are available before users sp we
             // need to make sure the body nodes are all deserialized before
             // referencing them.
-            json jbody_nodes = jbody["nodes"];
+            const json& jbody_nodes = jbody.at("nodes");
             NodeVector body_nodes;
-            for (json jnode : jbody_nodes)
+            for (const json& jnode : jbody_nodes)
             {
                 body_nodes.push_back(deserialize_node(jnode));
             }
-            json jparams = jbody["parameters"];
+            const json& jparams = jbody.at("parameters");
             ParameterVector parameters;
-            for (json jparam : jparams)
+            for (const json& jparam : jparams)
             {
                 parameters.push_back(as_type_ptr<op::Parameter>(deserialize_node(jparam)));
             }
-            json jresults = jbody["results"];
+            const json& jresults = jbody.at("results");
             ResultVector results;
-            for (json jresult : jresults)
+            for (const json& jresult : jresults)
             {
                 results.push_back(as_type_ptr<op::Result>(deserialize_node(jresult)));
             }
             ti->set_body(make_shared<op::TensorIterator::BodyLambda>(results, parameters));
-            json jins = node_js["input_descriptions"];
-            for (json jin : jins)
+            const json& jins = node_js.at("input_descriptions");
+            for (const json& jin : jins)
             {
                 ti->get_input_descriptions().push_back(
                     deserialize_tensor_iterator_input_description(jin));
             }
-            json jouts = node_js["output_descriptions"];
-            for (json jout : jouts)
+            const json& jouts = node_js.at("output_descriptions");
+            for (const json& jout : jouts)
             {
                 ti->get_output_descriptions().push_back(
                     deserialize_tensor_iterator_output_description(jout));
@@ -3132,7 +3550,16 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant:
     {
         auto tmp = static_cast<const op::Constant*>(&n);
-        if (tmp->are_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+        if (m_binary_constant_data)
+        {
+            size_t offset = round_up(m_binary_constant_data_size, s_binary_constant_alignment);
+            m_binary_constants.push_back({offset, tmp});
+            m_binary_constant_data_size =
+                offset + shape_size(tmp->get_shape()) * tmp->get_element_type().size();
+            node["data_offset"] = offset;
+        }
+        else if (tmp->are_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_shape()) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -48,14 +48,46 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to the binary model format. The graph is stored as json and
+    ///    the data of constants is stored as is, aligned, after it. When a binary model is
+    ///    deserialized from a file the file is mapped, and constants use the mapped data
+    ///    without copying it, so it is only read from disk as it is used and is shared
+    ///    between processes loading the same model.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to a stream in the binary model format
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
-    /// \param str The json formatted string to deseriailze.
+    /// \param str The json formatted string to deseriailze, or the path of a model file.
+    ///    Binary model files are mapped rather than read.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
+    /// \brief Computes a digest of the structure of a Function. The digest covers the ops and
+    ///    their attributes, how they are connected, the element types and shapes of their
+    ///    outputs and the contents of constants. Node and tensor names are not included, so
+    ///    every copy of a model has the same digest no matter how it was built or loaded.
+    /// \param func The Function to hash
+    /// \returns The SHA-256 digest as a string of 64 hex digits, or an empty string if func
+    ///    has an op the serializer does not know or does not write all the attributes of, as
+    ///    functions that differ only in those attributes could not be told apart
+    std::string hash_function(std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serializes the attributes of a node: everything serialize writes for it except
+    ///    its names, inputs, outputs and control dependencies.
+    /// \param node The node to serialize
+    /// \returns A json string, or an empty string for an op the serializer does not know or
+    ///    does not write all the attributes of
+    std::string serialize_node_attributes(const Node& node);
+
     /// \brief If enabled adds output shapes to the serialized graph
     /// \param enable Set to true to enable or false otherwise
     ///
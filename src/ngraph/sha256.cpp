@@ -0,0 +1,179 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "ngraph/sha256.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const uint32_t s_round_constants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+    0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+    0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+    0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+    0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+    0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+    0xc67178f2};
+
+static inline uint32_t rotate_right(uint32_t x, int n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+SHA256::SHA256()
+    : m_state{0x6a09e667,
+              0xbb67ae85,
+              0x3c6ef372,
+              0xa54ff53a,
+              0x510e527f,
+              0x9b05688c,
+              0x1f83d9ab,
+              0x5be0cd19}
+    , m_buffer_size(0)
+    , m_message_size(0)
+{
+}
+
+void SHA256::update(const void* data, size_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    m_message_size += size;
+    if (m_buffer_size > 0)
+    {
+        size_t n = min(size, sizeof(m_buffer) - m_buffer_size);
+        memcpy(m_buffer + m_buffer_size, bytes, n);
+        m_buffer_size += n;
+        bytes += n;
+        size -= n;
+        if (m_buffer_size < sizeof(m_buffer))
+        {
+            return;
+        }
+        process_block(m_buffer);
+        m_buffer_size = 0;
+    }
+    // Whole blocks are read in place
+    for (; size >= sizeof(m_buffer); bytes += sizeof(m_buffer), size -= sizeof(m_buffer))
+    {
+        process_block(bytes);
+    }
+    memcpy(m_buffer, bytes, size);
+    m_buffer_size = size;
+}
+
+void SHA256::update(uint64_t value)
+{
+    uint8_t bytes[8];
+    for (size_t i = 0; i < 8; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(value >> (56 - 8 * i));
+    }
+    update(bytes, sizeof(bytes));
+}
+
+void SHA256::update(const string& value)
+{
+    update(static_cast<uint64_t>(value.size()));
+    update(value.data(), value.size());
+}
+
+string SHA256::get_hex() const
+{
+    // Pad a copy so more data can still be added to this one
+    SHA256 last = *this;
+    uint64_t message_bits = m_message_size * 8;
+    uint8_t padding[72] = {0x80};
+    size_t padding_size = (m_buffer_size < 56 ? 56 : 120) - m_buffer_size;
+    last.update(padding, padding_size);
+    last.update(message_bits);
+
+    stringstream ss;
+    ss << hex << setfill('0');
+    for (uint32_t word : last.m_state)
+    {
+        ss << setw(8) << word;
+    }
+    return ss.str();
+}
+
+void SHA256::process_block(const uint8_t* block)
+{
+    uint32_t w[64];
+    for (size_t i = 0; i < 16; i++)
+    {
+        w[i] = (uint32_t(block[4 * i]) << 24) | (uint32_t(block[4 * i + 1]) << 16) |
+               (uint32_t(block[4 * i + 2]) << 8) | uint32_t(block[4 * i + 3]);
+    }
+    for (size_t i = 16; i < 64; i++)
+    {
+        uint32_t s0 = rotate_right(w[i - 15], 7) ^ rotate_right(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotate_right(w[i - 2], 17) ^ rotate_right(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = m_state[0];
+    uint32_t b = m_state[1];
+    uint32_t c = m_state[2];
+    uint32_t d = m_state[3];
+    uint32_t e = m_state[4];
+    uint32_t f = m_state[5];
+    uint32_t g = m_state[6];
+    uint32_t h = m_state[7];
+    for (size_t i = 0; i < 64; i++)
+    {
+        uint32_t s1 = rotate_right(e, 6) ^ rotate_right(e, 11) ^ rotate_right(e, 25);
+        uint32_t choice = (e & f) ^ (~e & g);
+        uint32_t t1 = h + s1 + choice + s_round_constants[i] + w[i];
+        uint32_t s0 = rotate_right(a, 2) ^ rotate_right(a, 13) ^ rotate_right(a, 22);
+        uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = s0 + majority;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    m_state[0] += a;
+    m_state[1] += b;
+    m_state[2] += c;
+    m_state[3] += d;
+    m_state[4] += e;
+    m_state[5] += f;
+    m_state[6] += g;
+    m_state[7] += h;
+}
+
+string ngraph::sha256_hex(const string& value)
+{
+    SHA256 digest;
+    digest.update(value.data(), value.size());
+    return digest.get_hex();
+}
@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ngraph
+{
+    /// \brief Computes the SHA-256 digest (FIPS 180-4) of data passed in any number of pieces
+    class SHA256
+    {
+    public:
+        SHA256();
+
+        /// \brief Appends size bytes at data to the message
+        void update(const void* data, size_t size);
+        /// \brief Appends the length of value and then value, so that adjacent strings cannot
+        ///    run into each other
+        void update(const std::string& value);
+        void update(uint64_t value);
+
+        /// \returns The digest of the message so far as 64 lower case hex digits
+        std::string get_hex() const;
+
+    private:
+        void process_block(const uint8_t* block);
+
+        uint32_t m_state[8];
+        uint8_t m_buffer[64];
+        size_t m_buffer_size;
+        uint64_t m_message_size;
+    };
+
+    /// \returns The SHA-256 digest of value as 64 lower case hex digits
+    std::string sha256_hex(const std::string& value);
+}
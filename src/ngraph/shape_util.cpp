@@ -103,3 +103,66 @@ PartialShape
         return PartialShape{result_dims};
     }
 }
+
+void ngraph::simplify_transpose(const Shape& in_shape,
+                                const AxisVector& axis_order,
+                                Shape& simple_shape,
+                                AxisVector& simple_order)
+{
+    // Position of every kept input axis among the kept input axes
+    std::vector<size_t> kept_position(in_shape.size());
+    size_t kept_count = 0;
+    for (size_t axis = 0; axis < in_shape.size(); axis++)
+    {
+        kept_position[axis] = kept_count;
+        kept_count += in_shape[axis] != 1;
+    }
+
+    // Runs of consecutive input axes, in output order
+    std::vector<std::pair<size_t, size_t>> groups;
+    for (size_t axis : axis_order)
+    {
+        if (in_shape[axis] == 1)
+        {
+            continue;
+        }
+        if (!groups.empty() && kept_position[groups.back().second] + 1 == kept_position[axis])
+        {
+            groups.back().second = axis;
+        }
+        else
+        {
+            groups.push_back({axis, axis});
+        }
+    }
+
+    // The groups in input order
+    std::vector<size_t> input_order(groups.size());
+    for (size_t i = 0; i < groups.size(); i++)
+    {
+        input_order[i] = i;
+    }
+    std::sort(input_order.begin(), input_order.end(), [&](size_t a, size_t b) {
+        return groups[a].first < groups[b].first;
+    });
+
+    simple_shape.assign(groups.size(), 1);
+    simple_order.assign(groups.size(), 0);
+    for (size_t i = 0; i < groups.size(); i++)
+    {
+        size_t group = input_order[i];
+        for (size_t axis = groups[group].first; axis <= groups[group].second; axis++)
+        {
+            simple_shape[i] *= in_shape[axis];
+        }
+        simple_order[group] = i;
+    }
+}
+
+bool ngraph::is_layout_preserving_transpose(const Shape& in_shape, const AxisVector& axis_order)
+{
+    Shape simple_shape;
+    AxisVector simple_order;
+    simplify_transpose(in_shape, axis_order, simple_shape, simple_order);
+    return simple_order.size() <= 1;
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "ngraph/axis_vector.hpp"
 #include "ngraph/partial_shape.hpp"
 
 namespace ngraph
@@ -112,4 +113,20 @@ namespace ngraph
                             std::vector<std::pair<size_t, AXIS_VALUE>>{
                                 std::pair<size_t, AXIS_VALUE>(new_axis_pos, new_axis_val)});
     }
+
+    /// \brief Reduces the transpose of in_shape by axis_order to the smallest equivalent
+    /// one: axes of size one are dropped and runs of input axes that stay next to each
+    /// other in the output are merged.
+    ///
+    /// \param simple_shape Set to the input shape of the reduced transpose
+    /// \param simple_order Set to its axis order. It is empty or 0,1,...,n-1 if the
+    ///    transpose does not move any data.
+    void simplify_transpose(const Shape& in_shape,
+                            const AxisVector& axis_order,
+                            Shape& simple_shape,
+                            AxisVector& simple_order);
+
+    /// \returns True if transposing in_shape by axis_order leaves the elements in the
+    /// same order, so the data can be used as it is
+    bool is_layout_preserving_transpose(const Shape& in_shape, const AxisVector& axis_order);
 }
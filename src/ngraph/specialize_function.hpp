@@ -122,7 +122,8 @@ namespace ngraph
     ///          the corresponding parameter.
     /// \param constant_folding If flag is true, constant propagation is applied
     /// \param share_constants If flag is true, cloned function will have shared constants with
-    ///          original function.
+    ///          original function. Otherwise the constants are new nodes, which still share
+    ///          their data with the original constants until either one is written to.
     /// \return A clone of f, with the parameter element types, shapes, and values specialized.
     /// \throws CheckFailure if parameter_element_types, parameter_shapes is not valid
     ///         (see details).
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cerrno>
 #include <deque>
 #include <forward_list>
 #include <iomanip>
@@ -401,6 +402,34 @@ namespace ngraph
         }
         return result;
     }
+
+    template <>
+    int64_t parse_string<int64_t>(const std::string& s)
+    {
+        const char* tmp = s.c_str();
+        char* end;
+        errno = 0;
+        long long result = strtoll(tmp, &end, 10);
+        if (end == tmp || *end != 0 || errno == ERANGE)
+        {
+            throw std::runtime_error("Could not parse literal '" + s + "'");
+        }
+        return result;
+    }
+
+    template <>
+    uint64_t parse_string<uint64_t>(const std::string& s)
+    {
+        const char* tmp = s.c_str();
+        char* end;
+        errno = 0;
+        unsigned long long result = strtoull(tmp, &end, 10);
+        if (end == tmp || *end != 0 || errno == ERANGE)
+        {
+            throw std::runtime_error("Could not parse literal '" + s + "'");
+        }
+        return result;
+    }
 }
 
 std::ostream& operator<<(std::ostream& os, const ngraph::NodeVector& nv)
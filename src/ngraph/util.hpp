@@ -162,6 +162,13 @@ namespace ngraph
     template <>
     double parse_string<double>(const std::string& s);
 
+    /// template specializations for the integer types constants are read as, which avoid the
+    /// cost of a stringstream.
+    template <>
+    int64_t parse_string<int64_t>(const std::string& s);
+    template <>
+    uint64_t parse_string<uint64_t>(const std::string& s);
+
     /// Parses a list of strings containing literals of the underlying type.
     template <typename T>
     std::vector<T> parse_string(const std::vector<std::string>& ss)
@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 
@@ -191,3 +192,98 @@ NGRAPH_TEST(${BACKEND_NAME}, auto_bcast_binary_elementwise_pdpd_dynamic)
     ex->call_with_validate({t_r}, {t_a, t_b});
     ASSERT_EQ(t_r->get_shape(), (Shape{2, 3, 4, 5}));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, auto_bcast_binary_elementwise_shapes)
+{
+    // Shapes chosen to cover merged axes, broadcasts on inner and outer axes, scalars and
+    // outputs large enough to be split across threads
+    vector<pair<Shape, Shape>> shape_pairs{{Shape{2, 3, 4, 5}, Shape{3, 1, 1}},
+                                           {Shape{2, 3, 4, 5}, Shape{}},
+                                           {Shape{}, Shape{4, 5}},
+                                           {Shape{3, 1}, Shape{1, 4}},
+                                           {Shape{1, 4, 1}, Shape{3, 1, 5}},
+                                           {Shape{2, 1, 4, 1}, Shape{2, 3, 1, 5}},
+                                           {Shape{6, 1, 1, 7}, Shape{6, 7}},
+                                           {Shape{1, 1}, Shape{1}},
+                                           {Shape{64, 33, 17}, Shape{64, 1, 17}},
+                                           {Shape{3, 40000}, Shape{3, 1}},
+                                           {Shape{100003}, Shape{100003}}};
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    for (auto& shapes : shape_pairs)
+    {
+        Shape a_shape = shapes.first;
+        Shape b_shape = shapes.second;
+        auto A = make_shared<op::Parameter>(element::f32, a_shape);
+        auto B = make_shared<op::Parameter>(element::f32, b_shape);
+        auto f = make_shared<Function>(
+            make_shared<op::Subtract>(A, B, op::AutoBroadcastType::NUMPY), ParameterVector{A, B});
+        Shape out_shape = f->get_output_shape(0);
+
+        vector<float> a_data(shape_size(a_shape));
+        vector<float> b_data(shape_size(b_shape));
+        iota(a_data.begin(), a_data.end(), 0.0f);
+        iota(b_data.begin(), b_data.end(), 0.5f);
+
+        // Left pad both shapes to the output rank and index the inputs coordinate by
+        // coordinate
+        while (a_shape.size() < out_shape.size())
+        {
+            a_shape.insert(a_shape.begin(), 1);
+        }
+        while (b_shape.size() < out_shape.size())
+        {
+            b_shape.insert(b_shape.begin(), 1);
+        }
+        vector<float> expected;
+        for (const Coordinate& coordinate : CoordinateTransform(out_shape))
+        {
+            size_t a_index = 0;
+            size_t b_index = 0;
+            for (size_t axis = 0; axis < out_shape.size(); axis++)
+            {
+                a_index = a_index * a_shape[axis] + (a_shape[axis] == 1 ? 0 : coordinate[axis]);
+                b_index = b_index * b_shape[axis] + (b_shape[axis] == 1 ? 0 : coordinate[axis]);
+            }
+            expected.push_back(a_data[a_index] - b_data[b_index]);
+        }
+
+        auto a = backend->create_tensor(element::f32, shapes.first);
+        auto b = backend->create_tensor(element::f32, shapes.second);
+        auto result = backend->create_tensor(element::f32, out_shape);
+        copy_data(a, a_data);
+        copy_data(b, b_data);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_EQ(expected, read_vector<float>(result)) << shapes.first << " - " << shapes.second;
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, auto_bcast_binary_elementwise_zero_sized)
+{
+    // An axis of size zero against one of size one broadcasts to zero elements
+    vector<pair<Shape, Shape>> shape_pairs{{Shape{0, 3}, Shape{1, 3}},
+                                           {Shape{1, 3}, Shape{0, 1}},
+                                           {Shape{2, 0}, Shape{2, 1}},
+                                           {Shape{4, 1, 5}, Shape{0, 1}}};
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    for (auto& shapes : shape_pairs)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shapes.first);
+        auto B = make_shared<op::Parameter>(element::f32, shapes.second);
+        auto f = make_shared<Function>(
+            make_shared<op::Add>(A, B, op::AutoBroadcastType::NUMPY), ParameterVector{A, B});
+        Shape out_shape = f->get_output_shape(0);
+        ASSERT_EQ(0, shape_size(out_shape));
+
+        auto a = backend->create_tensor(element::f32, shapes.first);
+        auto b = backend->create_tensor(element::f32, shapes.second);
+        copy_data(a, vector<float>(shape_size(shapes.first), 1.0f));
+        copy_data(b, vector<float>(shape_size(shapes.second), 2.0f));
+        // Nothing may be written to the memory behind the empty result
+        vector<float> guard(32, -1.0f);
+        auto result = backend->create_tensor(element::f32, out_shape, guard.data());
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_EQ(vector<float>(32, -1.0f), guard) << shapes.first << " + " << shapes.second;
+    }
+}
@@ -16,10 +16,12 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/known_element_types.hpp"
 #include "util/ndarray.hpp"
+#include "util/random.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
 
@@ -236,3 +238,69 @@ NGRAPH_TEST(${BACKEND_NAME}, dyn_convolution_backprop_filter)
     handle->call_with_validate({result}, {a, b, c});
     EXPECT_FALSE(test::all_close_f(vector<float>{expected_result}, read_vector<float>(result)));
 }
+
+// Checks the lowered reference convolutions (Winograd for the first case, im2col for the
+// others) against the direct convolution kernel.
+NGRAPH_TEST(${BACKEND_NAME}, convolution_matches_direct)
+{
+    struct ConvolutionCase
+    {
+        Shape data_shape;
+        Shape filters_shape;
+        Strides strides;
+        Strides dilations;
+        CoordinateDiff pad_below;
+        CoordinateDiff pad_above;
+        Strides data_dilations;
+    };
+    vector<ConvolutionCase> cases{
+        {{2, 3, 9, 7}, {4, 3, 3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}},
+        {{2, 3, 9, 7}, {4, 3, 3, 2}, {2, 3}, {1, 1}, {1, 0}, {2, 1}, {1, 1}},
+        {{1, 2, 8, 6}, {3, 2, 2, 2}, {1, 1}, {2, 1}, {1, 0}, {0, 1}, {2, 3}},
+        {{2, 3, 17}, {4, 3, 3}, {2}, {1}, {1}, {2}, {1}}};
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (const ConvolutionCase& c : cases)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, c.data_shape);
+        auto B = make_shared<op::Parameter>(element::f32, c.filters_shape);
+        auto conv = make_shared<op::Convolution>(
+            A, B, c.strides, c.dilations, c.pad_below, c.pad_above, c.data_dilations);
+        auto f = make_shared<Function>(conv, ParameterVector{A, B});
+        Shape out_shape = conv->get_shape();
+
+        vector<float> data(shape_size(c.data_shape));
+        vector<float> filters(shape_size(c.filters_shape));
+        rng.initialize(data);
+        rng.initialize(filters);
+        vector<float> expected(shape_size(out_shape));
+        runtime::reference::general_convolution_direct<float, float, float>(data.data(),
+                                                                             filters.data(),
+                                                                             expected.data(),
+                                                                             c.data_shape,
+                                                                             c.filters_shape,
+                                                                             out_shape,
+                                                                             c.strides,
+                                                                             c.dilations,
+                                                                             c.pad_below,
+                                                                             c.pad_above,
+                                                                             c.data_dilations,
+                                                                             0,
+                                                                             1,
+                                                                             0,
+                                                                             1,
+                                                                             0,
+                                                                             1);
+
+        auto a = backend->create_tensor(element::f32, c.data_shape);
+        copy_data(a, data);
+        auto b = backend->create_tensor(element::f32, c.filters_shape);
+        copy_data(b, filters);
+        auto result = backend->create_tensor(element::f32, out_shape);
+
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    }
+}
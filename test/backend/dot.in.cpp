@@ -793,3 +793,48 @@ NGRAPH_TEST(${BACKEND_NAME}, dot_3d_one_axis_arbitrary)
                        27,   106, 149, 126, 65,  25,   44,   6,   11,  165,  281,  52}),
         read_vector<float>(result)));
 }
+
+// Large enough to span several blocks of the reference dot kernel along every axis
+NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_multi_block)
+{
+    Shape shape_a{70, 130};
+    Shape shape_b{130, 260};
+    Shape shape_r{70, 260};
+    auto A = make_shared<op::Parameter>(element::i32, shape_a);
+    auto B = make_shared<op::Parameter>(element::i32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<int32_t> a_data(shape_size(shape_a));
+    vector<int32_t> b_data(shape_size(shape_b));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<int32_t>(i % 7) - 3;
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<int32_t>(i % 5) - 2;
+    }
+    vector<int32_t> expected(shape_size(shape_r), 0);
+    for (size_t m = 0; m < 70; m++)
+    {
+        for (size_t n = 0; n < 260; n++)
+        {
+            for (size_t k = 0; k < 130; k++)
+            {
+                expected[m * 260 + n] += a_data[m * 130 + k] * b_data[k * 260 + n];
+            }
+        }
+    }
+
+    auto a = backend->create_tensor(element::i32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::i32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::i32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(expected, read_vector<int32_t>(result));
+}
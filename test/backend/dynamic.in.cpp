@@ -292,3 +292,35 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_reverse_shape)
                         Shape{8, 2, 8, 2},
                         Shape{2, 3, 4, 5, 2}});
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_reshape_cached)
+{
+    // The output shape depends on the value of the shape input, so every value gets its own
+    // compiled clone. Alternate between values so that the cached clones are reused.
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto shape = make_shared<op::Parameter>(element::i64, PartialShape{2});
+    auto reshape = make_shared<op::DynReshape>(x, shape);
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Negative>(reshape)},
+                                   ParameterVector{x, shape});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = backend->compile(f);
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic());
+
+    vector<vector<int64_t>> shapes{{2, 3}, {3, 2}, {1, 6}};
+    for (size_t i = 0; i < 9; i++)
+    {
+        const vector<int64_t>& out_shape = shapes[i % shapes.size()];
+        vector<float> values(6, static_cast<float>(i));
+        auto t_x = backend->create_tensor(element::f32, Shape{6});
+        copy_data(t_x, values);
+        auto t_shape = backend->create_tensor(element::i64, Shape{2});
+        copy_data(t_shape, out_shape);
+
+        ex->call_with_validate({t_r}, {t_x, t_shape});
+
+        ASSERT_EQ(t_r->get_shape(),
+                  (Shape{static_cast<size_t>(out_shape[0]), static_cast<size_t>(out_shape[1])}));
+        EXPECT_EQ(read_vector<float>(t_r), vector<float>(6, -static_cast<float>(i)));
+    }
+}
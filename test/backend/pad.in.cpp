@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <numeric>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close.hpp"
@@ -972,3 +975,83 @@ NGRAPH_TEST(${BACKEND_NAME}, pad_symmetric)
                                   read_vector<float>(result),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+// The input coordinate along one axis that position of the padded output takes its value
+// from, or -1 for the pad value
+static ptrdiff_t naive_pad_source(op::PadMode pad_mode,
+                                  ptrdiff_t position,
+                                  ptrdiff_t below,
+                                  ptrdiff_t size)
+{
+    ptrdiff_t c = position - below;
+    switch (pad_mode)
+    {
+    case op::PadMode::CONSTANT: return c < 0 || c >= size ? -1 : c;
+    case op::PadMode::EDGE: return min(max<ptrdiff_t>(c, 0), size - 1);
+    case op::PadMode::REFLECT:
+    {
+        ptrdiff_t period = 2 * (size - 1);
+        c = (c % period + period) % period;
+        return c < size ? c : period - c;
+    }
+    case op::PadMode::SYMMETRIC: break;
+    }
+    return -1;
+}
+
+// Pads with positive and negative paddings on the same and on different axes, and with
+// paddings larger than the input, and checks every element against its source
+NGRAPH_TEST(${BACKEND_NAME}, pad_3d_positive_and_negative)
+{
+    Shape shape_a{3, 4, 5};
+    vector<pair<CoordinateDiff, CoordinateDiff>> paddings{
+        {CoordinateDiff{1, 2, 0}, CoordinateDiff{2, 0, 3}},
+        {CoordinateDiff{-1, 2, -2}, CoordinateDiff{1, -1, 3}},
+        {CoordinateDiff{0, -3, 1}, CoordinateDiff{-2, 3, -4}},
+        {CoordinateDiff{-1, -1, -1}, CoordinateDiff{-1, -1, -1}},
+        {CoordinateDiff{4, 5, 6}, CoordinateDiff{5, 4, 6}}};
+    vector<float> a_data(shape_size(shape_a));
+    iota(a_data.begin(), a_data.end(), 1.0f);
+    float pad_value = -1;
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    for (auto pad_mode : {op::PadMode::CONSTANT, op::PadMode::EDGE, op::PadMode::REFLECT})
+    {
+        for (auto& padding : paddings)
+        {
+            const CoordinateDiff& below = padding.first;
+            const CoordinateDiff& above = padding.second;
+            auto A = make_shared<op::Parameter>(element::f32, shape_a);
+            auto B = make_shared<op::Parameter>(element::f32, Shape{});
+            auto f = make_shared<Function>(make_shared<op::Pad>(A, B, below, above, pad_mode),
+                                           ParameterVector{A, B});
+            Shape shape_r = f->get_output_shape(0);
+
+            vector<float> expected;
+            for (const Coordinate& coordinate : CoordinateTransform(shape_r))
+            {
+                size_t index = 0;
+                bool is_pad = false;
+                for (size_t i = 0; i < shape_a.size(); i++)
+                {
+                    ptrdiff_t source =
+                        naive_pad_source(pad_mode, coordinate[i], below[i], shape_a[i]);
+                    is_pad |= source < 0;
+                    index = index * shape_a[i] + source;
+                }
+                expected.push_back(is_pad ? pad_value : a_data[index]);
+            }
+
+            auto a = backend->create_tensor(element::f32, shape_a);
+            copy_data(a, a_data);
+            auto b = backend->create_tensor(element::f32, Shape{});
+            copy_data(b, vector<float>{pad_value});
+            auto result = backend->create_tensor(element::f32, shape_r);
+            auto handle = backend->compile(f);
+            handle->call_with_validate({result}, {a, b});
+            EXPECT_EQ(expected, read_vector<float>(result))
+                << "mode " << static_cast<int>(pad_mode) << " below " << below << " above "
+                << above;
+        }
+    }
+}
@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 
@@ -597,3 +598,69 @@ NGRAPH_TEST(${BACKEND_NAME}, reshape_shufflenet_5d)
 }
 
 #endif // NGRAPH_INTERPRETER_ENABLE
+
+NGRAPH_TEST(${BACKEND_NAME}, reshape_transpose_large)
+{
+    // Sizes that leave partial tiles, with axes on either side of the tiled ones
+    vector<pair<Shape, AxisVector>> cases{{Shape{70, 37}, AxisVector{1, 0}},
+                                          {Shape{3, 37, 70}, AxisVector{0, 2, 1}},
+                                          {Shape{2, 33, 5, 41}, AxisVector{0, 2, 3, 1}},
+                                          {Shape{2, 5, 41, 33}, AxisVector{0, 3, 1, 2}},
+                                          {Shape{4, 9, 6, 16}, AxisVector{0, 2, 1, 3}},
+                                          {Shape{3, 1, 40, 1, 20}, AxisVector{4, 3, 0, 2, 1}}};
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    for (auto& c : cases)
+    {
+        const Shape& shape_a = c.first;
+        const AxisVector& order = c.second;
+        Shape shape_r;
+        for (size_t axis : order)
+        {
+            shape_r.push_back(shape_a[axis]);
+        }
+        auto A = make_shared<op::Parameter>(element::i32, shape_a);
+        auto f = make_shared<Function>(make_shared<op::Reshape>(A, order, shape_r),
+                                       ParameterVector{A});
+
+        vector<int32_t> a_data(shape_size(shape_a));
+        iota(a_data.begin(), a_data.end(), 0);
+        Strides a_strides = row_major_strides(shape_a);
+        vector<int32_t> expected;
+        for (const Coordinate& coordinate : CoordinateTransform(shape_r))
+        {
+            size_t index = 0;
+            for (size_t i = 0; i < order.size(); i++)
+            {
+                index += coordinate[i] * a_strides[order[i]];
+            }
+            expected.push_back(a_data[index]);
+        }
+
+        auto a = backend->create_tensor(element::i32, shape_a);
+        copy_data(a, a_data);
+        auto result = backend->create_tensor(element::i32, shape_r);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_EQ(expected, read_vector<int32_t>(result)) << shape_a;
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, reshape_move_unit_axes_between_ops)
+{
+    // The reshape only moves axes of size one, so its output may share memory with its input
+    Shape shape_a{2, 1, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto r = make_shared<op::Reshape>(make_shared<op::Negative>(A), AxisVector{1, 0, 2}, Shape{6});
+    auto f = make_shared<Function>(make_shared<op::Add>(r, r), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::f32, Shape{6});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f((vector<float>{-2, -4, -6, -8, -10, -12}),
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
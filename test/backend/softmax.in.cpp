@@ -290,3 +290,59 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_overflow)
                            expf(5) / d2};
     EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, softmax_innermost_axes)
+{
+    // Innermost axes, possibly followed by axes of length 1, are normalized row by row
+    vector<pair<Shape, AxisSet>> cases{{Shape{3, 1000}, AxisSet{1}},
+                                       {Shape{2, 3, 40, 1}, AxisSet{2}},
+                                       {Shape{2, 3, 40}, AxisSet{1, 2}},
+                                       {Shape{5}, AxisSet{0}},
+                                       {Shape{2, 3, 40}, AxisSet{0, 2}}};
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    for (auto& c : cases)
+    {
+        const Shape& shape = c.first;
+        const AxisSet& axes = c.second;
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::Softmax>(A, axes), ParameterVector{A});
+
+        vector<float> v_a(shape_size(shape));
+        for (size_t i = 0; i < v_a.size(); i++)
+        {
+            v_a[i] = static_cast<float>((i * 7919) % 97) / 8.0f - 6.0f;
+        }
+
+        Shape reduced_shape = reduce(shape, axes);
+        vector<double> max(shape_size(reduced_shape), numeric_limits<double>::lowest());
+        vector<double> sum(shape_size(reduced_shape), 0);
+        CoordinateTransform transform(shape);
+        CoordinateTransform reduced_transform(reduced_shape);
+        for (const Coordinate& coord : transform)
+        {
+            double& m = max[reduced_transform.index(reduce(coord, axes))];
+            m = std::max(m, static_cast<double>(v_a[transform.index(coord)]));
+        }
+        for (const Coordinate& coord : transform)
+        {
+            size_t index = reduced_transform.index(reduce(coord, axes));
+            sum[index] += exp(v_a[transform.index(coord)] - max[index]);
+        }
+        vector<float> expected(v_a.size());
+        for (const Coordinate& coord : transform)
+        {
+            size_t index = reduced_transform.index(reduce(coord, axes));
+            size_t i = transform.index(coord);
+            expected[i] = static_cast<float>(exp(v_a[i] - max[index]) / sum[index]);
+        }
+
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, v_a);
+        auto result = backend->create_tensor(element::f32, shape);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result))) << shape << " "
+                                                                            << axes;
+    }
+}
@@ -128,6 +128,45 @@ NGRAPH_TEST(${BACKEND_NAME}, sum_large_1d_to_scalar)
         test::all_close_f(vector<float>{static_cast<float>(r)}, read_vector<float>(result)));
 }
 
+// Reduced and kept axes that alternate, and long rows and columns that are reduced in blocks
+NGRAPH_TEST(${BACKEND_NAME}, sum_large_axis_layouts)
+{
+    vector<pair<Shape, AxisSet>> cases{{Shape{3, 40, 5, 70}, AxisSet{0, 2}},
+                                       {Shape{6, 1, 7, 3, 20, 11}, AxisSet{1, 2, 4}},
+                                       {Shape{2, 40000}, AxisSet{1}},
+                                       {Shape{40000, 3}, AxisSet{0}},
+                                       {Shape{4, 300, 300}, AxisSet{1}}};
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    random_generator.seed(2);
+    for (auto& c : cases)
+    {
+        const Shape& shape = c.first;
+        const AxisSet& axes = c.second;
+        auto A = make_shared<op::Parameter>(element::i32, shape);
+        auto f = make_shared<Function>(make_shared<op::Sum>(A, axes), ParameterVector{A});
+        Shape out_shape = f->get_output_shape(0);
+
+        vector<int32_t> v_a(shape_size(shape));
+        vector<int32_t> expected(shape_size(out_shape), 0);
+        CoordinateTransform input_transform(shape);
+        CoordinateTransform output_transform(out_shape);
+        for (const Coordinate& coord : input_transform)
+        {
+            size_t index = input_transform.index(coord);
+            v_a[index] = static_cast<int32_t>(random_generator() % 255) - 127;
+            expected[output_transform.index(reduce(coord, axes))] += v_a[index];
+        }
+
+        auto a = backend->create_tensor(element::i32, shape);
+        copy_data(a, v_a);
+        auto result = backend->create_tensor(element::i32, out_shape);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_EQ(expected, read_vector<int32_t>(result)) << shape << " " << axes;
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, sum_matrix_columns)
 {
     Shape shape_a{3, 2};
@@ -14,9 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <fstream>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
@@ -91,6 +95,30 @@ TEST(backend_api, save_load)
 }
 #endif
 
+TEST(backend_api, call_releases_tensors)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data<float>(a, {1.f, 2.f, 3.f, 4.f});
+    copy_data<float>(b, {5.f, 6.f, 7.f, 8.f});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {6.f, 8.f, 10.f, 12.f}));
+
+    // The executable does not hold on to the caller's tensors once the call returns
+    EXPECT_EQ(a.use_count(), 1);
+    EXPECT_EQ(b.use_count(), 1);
+    EXPECT_EQ(result.use_count(), 1);
+}
+
 #if defined(NGRAPH_INTERPRETER_ENABLE) && defined(NGRAPH_CPU_ENABLE)
 TEST(backend_api, executable_can_create_tensor)
 {
@@ -101,3 +129,66 @@ TEST(backend_api, executable_can_create_tensor)
     EXPECT_FALSE(cpu->executable_can_create_tensors());
 }
 #endif
+
+TEST(backend_api, executable_cache)
+{
+    auto make_function = [](float value) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto C = op::Constant::create(element::f32, Shape{4}, {value});
+        return make_shared<Function>(make_shared<op::Multiply>(A, C), ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    string directory = file_util::path_join(file_util::get_temp_directory_path(), "ngraph_cache");
+    file_util::remove_directory(directory);
+
+    runtime::ExecutableCache cache(backend, 1, directory);
+    auto exec = cache.compile(make_function(2.0f));
+    EXPECT_EQ(cache.compile(make_function(2.0f)), exec);
+    EXPECT_EQ(cache.get_hit_count(), 1);
+    EXPECT_EQ(cache.get_compile_count(), 1);
+
+    // The least recently used executable is evicted
+    EXPECT_NE(cache.compile(make_function(3.0f)), exec);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.get_compile_count(), 2);
+
+    // A new cache sharing the directory loads instead of compiling
+    runtime::ExecutableCache other(backend, 4, directory);
+    auto loaded = other.compile(make_function(2.0f));
+    EXPECT_EQ(other.get_load_count(), 1);
+    EXPECT_EQ(other.get_compile_count(), 0);
+
+    auto a = backend->create_tensor(element::f32, Shape{4});
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto result = backend->create_tensor(element::f32, Shape{4});
+    loaded->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<float>{2, 4, 6, 8}), read_vector<float>(result));
+
+    // A file whose stored key is not the one looked up is compiled over
+    file_util::iterate_files(directory, [](const string& file, bool is_dir) {
+        if (!is_dir)
+        {
+            ofstream out(file, ios::binary | ios::in);
+            out << "x";
+        }
+    });
+    runtime::ExecutableCache third(backend, 4, directory);
+    third.compile(make_function(2.0f));
+    EXPECT_EQ(third.get_load_count(), 0);
+    EXPECT_EQ(third.get_compile_count(), 1);
+
+    // Functions hash_function can not digest are compiled every time instead of sharing an
+    // executable
+    auto make_all_reduce = [](reduction::Type reduce_type) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+        return make_shared<Function>(make_shared<op::AllReduce>(A, reduce_type),
+                                     ParameterVector{A});
+    };
+    auto sum = third.compile(make_all_reduce(reduction::Type::SUM));
+    EXPECT_NE(third.compile(make_all_reduce(reduction::Type::MAX)), sum);
+    EXPECT_EQ(third.get_compile_count(), 3);
+    EXPECT_EQ(third.get_hit_count(), 0);
+
+    file_util::remove_directory(directory);
+}
@@ -74,3 +74,51 @@ TEST(INTERPRETER, nan_check_output)
     ihandle->set_nan_check(true);
     EXPECT_ANY_THROW(handle->call_with_validate({result}, {a, b}));
 }
+
+TEST(INTERPRETER, inter_op_concurrency)
+{
+    // Many independent branches whose intermediates share the memory pool
+    Shape shape{1000};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    NodeVector branches;
+    for (size_t i = 0; i < 16; i++)
+    {
+        auto c = op::Constant::create(element::f32, shape, vector<float>(1000, i + 1.0f));
+        auto t = make_shared<op::Multiply>(make_shared<op::Add>(A, c), A);
+        branches.push_back(make_shared<op::Tanh>(make_shared<op::Subtract>(t, c)));
+    }
+    while (branches.size() > 1)
+    {
+        NodeVector sums;
+        for (size_t i = 0; i < branches.size(); i += 2)
+        {
+            sums.push_back(make_shared<op::Add>(branches[i], branches[i + 1]));
+        }
+        branches = sums;
+    }
+    auto f = make_shared<Function>(branches[0], ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    vector<float> a_data(1000);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = (i % 17) * 0.125f - 1.0f;
+    }
+    copy_data(a, a_data);
+    auto expected = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto serial = backend->compile(f);
+    static_pointer_cast<runtime::interpreter::INTExecutable>(serial)->set_inter_op_concurrency(1);
+    serial->call_with_validate({expected}, {a});
+
+    auto concurrent = backend->compile(f);
+    static_pointer_cast<runtime::interpreter::INTExecutable>(concurrent)
+        ->set_inter_op_concurrency(4);
+    for (size_t i = 0; i < 20; i++)
+    {
+        concurrent->call_with_validate({result}, {a});
+        EXPECT_EQ(read_vector<float>(expected), read_vector<float>(result));
+    }
+}
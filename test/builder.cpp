@@ -126,6 +126,14 @@ TEST(builder, numpy_transpose)
     param = make_shared<op::Parameter>(element::f32, shape);
     transposed = as_type_ptr<op::Reshape>(builder::numpy_transpose(param, AxisVector{2, 0, 1}));
     EXPECT_EQ(Shape({8, 2, 4}), transposed->get_output_shape());
+    EXPECT_EQ(AxisVector({2, 0, 1}), transposed->get_input_order());
+
+    // Moving axes of size one only does not reorder the elements
+    shape = Shape{2, 1, 8, 1};
+    param = make_shared<op::Parameter>(element::f32, shape);
+    transposed = as_type_ptr<op::Reshape>(builder::numpy_transpose(param, AxisVector{1, 0, 3, 2}));
+    EXPECT_EQ(Shape({1, 2, 1, 8}), transposed->get_output_shape());
+    EXPECT_EQ(AxisVector({0, 1, 2, 3}), transposed->get_input_order());
 
     // Bad Orders
     EXPECT_ANY_THROW(as_type_ptr<op::Reshape>(builder::numpy_transpose(param, AxisVector{2})));
@@ -998,6 +998,45 @@ TEST(constant_folding, const_reducemean_keepdims)
     ASSERT_EQ(values_expected, values_out);
 }
 
+// The number of elements averaged does not fit in the element type
+TEST(constant_folding, const_reducemean_small_int)
+{
+    auto fold = [](const element::Type& type, Shape input_shape, const vector<int>& values_in) {
+        auto constant = op::Constant::create(type, input_shape, values_in);
+        auto constant_axes = op::Constant::create(element::i64, Shape{1}, vector<int64_t>{1});
+        auto f = make_shared<Function>(make_shared<op::v1::ReduceMean>(constant, constant_axes),
+                                       ParameterVector{});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.run_passes(f);
+
+        EXPECT_EQ(count_ops_of_type<op::v1::ReduceMean>(f), 0);
+        auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+        EXPECT_TRUE(new_const);
+        EXPECT_EQ(new_const->get_shape(), Shape{input_shape[0]});
+        return new_const->get_value_strings();
+    };
+
+    // Averaging 128 elements, a count narrowed to i8 would flip the sign
+    vector<int> values_in(2 * 128, 0);
+    values_in[0] = -128;
+    values_in[128] = -64;
+    values_in[129] = -64;
+    EXPECT_EQ((vector<string>{"-1", "-1"}), fold(element::i8, Shape{2, 128}, values_in));
+
+    // Averaging 256 elements, a count narrowed to 8 bits would be 0
+    values_in.assign(2 * 256, 0);
+    values_in[0] = 100;
+    values_in[256] = -100;
+    EXPECT_EQ((vector<string>{"0", "0"}), fold(element::i8, Shape{2, 256}, values_in));
+    values_in[256] = 255;
+    EXPECT_EQ((vector<string>{"0", "0"}), fold(element::u8, Shape{2, 256}, values_in));
+    values_in.assign(2 * 256, 0);
+    values_in[1] = 1;
+    EXPECT_EQ((vector<string>{"0", "0"}), fold(element::boolean, Shape{2, 256}, values_in));
+}
+
 TEST(constant_folding, const_all)
 {
     Shape input_shape{3, 3};
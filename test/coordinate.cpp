@@ -241,6 +241,135 @@ TEST(coordinate, axis_order)
     EXPECT_TRUE(it == ct.end());
 }
 
+TEST(coordinate, source_indices)
+{
+    Shape source_shape{4, 5, 6};
+    auto ct = CoordinateTransform(source_shape,
+                                  Coordinate{1, 0, 1},
+                                  Coordinate{4, 5, 6},
+                                  Strides{2, 1, 3},
+                                  AxisVector{2, 0, 1});
+    ASSERT_TRUE(ct.has_all_source_coordinates());
+
+    vector<size_t> expected;
+    for (const Coordinate& c : ct)
+    {
+        expected.push_back(ct.index(c));
+    }
+    vector<size_t> actual;
+    for (size_t index : ct.source_indices())
+    {
+        actual.push_back(index);
+    }
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(coordinate, source_indices_padding)
+{
+    Shape source_shape{1, 1, 4, 4};
+    CoordinateDiff padding{0, 0, 1, 1};
+    auto interior = CoordinateTransform(source_shape,
+                                        Coordinate{0, 0, 2, 2},
+                                        Coordinate{1, 1, 4, 4},
+                                        Strides{1, 1, 1, 1},
+                                        AxisVector{0, 1, 2, 3},
+                                        padding,
+                                        padding);
+    ASSERT_TRUE(interior.has_all_source_coordinates());
+    vector<size_t> actual;
+    for (size_t index : interior.source_indices())
+    {
+        actual.push_back(index);
+    }
+    EXPECT_EQ(actual, (vector<size_t>{5, 6, 9, 10}));
+
+    auto edge = CoordinateTransform(source_shape,
+                                    Coordinate{0, 0, 0, 0},
+                                    Coordinate{1, 1, 2, 2},
+                                    Strides{1, 1, 1, 1},
+                                    AxisVector{0, 1, 2, 3},
+                                    padding,
+                                    padding);
+    EXPECT_FALSE(edge.has_all_source_coordinates());
+    EXPECT_THROW(edge.source_indices(), std::domain_error);
+}
+
+static vector<size_t> to_vector(const StridedIndexRange& range)
+{
+    vector<size_t> result;
+    for (size_t index : range)
+    {
+        result.push_back(index);
+    }
+    return result;
+}
+
+TEST(coordinate, strided_index_range)
+{
+    auto contiguous = StridedIndexRange(Shape{2, 1, 3}, Strides{3, 3, 1});
+    EXPECT_TRUE(contiguous.is_contiguous());
+    EXPECT_EQ(contiguous.size(), 6);
+    EXPECT_EQ(to_vector(contiguous),
+              (vector<size_t>{0, 1, 2, 3, 4, 5}));
+
+    // [2,3] reduced over axis 1 and broadcast back
+    Shape shape{2, 3};
+    auto reduced = StridedIndexRange(shape, reduction_strides(shape, AxisSet{1}));
+    EXPECT_FALSE(reduced.is_contiguous());
+    EXPECT_EQ(to_vector(reduced),
+              (vector<size_t>{0, 0, 0, 1, 1, 1}));
+
+    auto scalar = StridedIndexRange(Shape{}, Strides{}, 7);
+    EXPECT_EQ(to_vector(scalar), (vector<size_t>{7}));
+
+    auto empty = StridedIndexRange(Shape{2, 0}, Strides{1, 1});
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(coordinate, merge_strided_axes)
+{
+    // [2,1,3,4] read transposed from [2,4,3] and written row-major. The write side alone
+    // could merge its last two axes, but the read side walks them out of order.
+    Shape shape{2, 1, 3, 4};
+    Strides read{12, 0, 1, 3};
+    Strides write{12, 12, 4, 1};
+    merge_strided_axes(shape, std::array<Strides*, 2>{{&read, &write}});
+    EXPECT_EQ(shape, (Shape{2, 3, 4}));
+    EXPECT_EQ(read, (Strides{12, 1, 3}));
+    EXPECT_EQ(write, (Strides{12, 4, 1}));
+
+    // Both sides contiguous, except for a broadcast outer axis on one of them
+    shape = Shape{5, 2, 3};
+    read = Strides{0, 3, 1};
+    write = Strides{6, 3, 1};
+    merge_strided_axes(shape, std::array<Strides*, 2>{{&read, &write}});
+    EXPECT_EQ(shape, (Shape{5, 6}));
+    EXPECT_EQ(read, (Strides{0, 1}));
+    EXPECT_EQ(write, (Strides{6, 1}));
+}
+
+TEST(coordinate, strided_counter)
+{
+    Shape shape{2, 3, 4};
+    Strides strides0{1, 2, 6};
+    vector<ptrdiff_t> strides1{-12, -4, -1};
+    // Start part way through a walk over the first two axes and a backwards walk over all
+    StridedCounter<Strides, 1> counter0(shape, {{&strides0}}, 2, 4, {{100}});
+    StridedCounter<vector<ptrdiff_t>, 1> counter1(shape, {{&strides1}}, 3, 5, {{23}});
+    vector<size_t> indices0;
+    vector<ptrdiff_t> indices1;
+    for (size_t i = 0; i < 3; i++)
+    {
+        indices0.push_back(counter0[0]);
+        indices1.push_back(counter1[0]);
+        ++counter0;
+        ++counter1;
+    }
+    // After its last coordinate the first walk starts over
+    EXPECT_EQ(indices0, (vector<size_t>{103, 105, 100}));
+    EXPECT_EQ(indices1, (vector<ptrdiff_t>{18, 17, 16}));
+}
+
 TEST(DISABLED_coordinate, padding)
 {
     Shape source_shape{10, 10};
@@ -335,3 +464,23 @@ TEST(benchmark, coordinate)
     timer.stop();
     cout << "time: " << timer.get_milliseconds() << endl;
 }
+
+TEST(benchmark, coordinate_source_indices)
+{
+    Shape source_shape{128, 3, 2000, 1000};
+    auto ct = CoordinateTransform(source_shape,
+                                  Coordinate{0, 0, 0, 0},
+                                  Coordinate{source_shape},
+                                  Strides(source_shape.size(), 1),
+                                  AxisVector{0, 1, 3, 2});
+
+    stopwatch timer;
+    timer.start();
+    size_t checksum = 0;
+    for (size_t index : ct.source_indices())
+    {
+        checksum += index;
+    }
+    timer.stop();
+    cout << "time: " << timer.get_milliseconds() << " checksum: " << checksum << endl;
+}
@@ -143,6 +143,58 @@ TEST(copy, constant)
     ASSERT_TRUE(node_cast->get_element_type() == et);
 }
 
+namespace
+{
+    class WritableConstant : public op::Constant
+    {
+    public:
+        WritableConstant(const op::Constant& constant)
+            : op::Constant(constant.get_element_type(),
+                           constant.get_shape(),
+                           constant.get_data_ptr())
+        {
+        }
+        using op::Constant::get_data_ptr_nc;
+    };
+}
+
+TEST(copy, constant_shares_data)
+{
+    Shape shape{2, 2};
+    vector<float> c{1.0f, 2.0f, 3.0f, 4.0f};
+    auto node = op::Constant::create(element::f32, shape, c);
+    auto new_node = as_type_ptr<op::Constant>(node->copy_with_new_args(NodeVector{}));
+    ASSERT_NE(new_node, nullptr);
+    EXPECT_NE(node, new_node);
+    EXPECT_EQ(node->get_data_ptr(), new_node->get_data_ptr());
+    EXPECT_EQ(new_node->get_vector<float>(), c);
+
+    auto f = make_shared<Function>(NodeVector{node}, ParameterVector{});
+    auto clone = clone_function(*f);
+    auto cloned_constant = as_type_ptr<op::Constant>(clone->get_results().at(0)->get_argument(0));
+    ASSERT_NE(cloned_constant, nullptr);
+    EXPECT_NE(node, cloned_constant);
+    EXPECT_EQ(node->get_data_ptr(), cloned_constant->get_data_ptr());
+}
+
+TEST(copy, constant_copy_on_write)
+{
+    vector<float> c{1.0f, 2.0f, 3.0f, 4.0f};
+    WritableConstant node(*op::Constant::create(element::f32, Shape{4}, c));
+    auto shared = as_type_ptr<op::Constant>(node.copy_with_new_args(NodeVector{}));
+    ASSERT_EQ(node.get_data_ptr(), shared->get_data_ptr());
+
+    // Writing takes a private copy, the other constant keeps its values
+    float* data = static_cast<float*>(node.get_data_ptr_nc());
+    EXPECT_NE(data, shared->get_data_ptr());
+    data[0] = 5.0f;
+    EXPECT_EQ(node.get_vector<float>(), (vector<float>{5.0f, 2.0f, 3.0f, 4.0f}));
+    EXPECT_EQ(shared->get_vector<float>(), c);
+
+    // Once it is not shared any more, data is written in place
+    EXPECT_EQ(node.get_data_ptr_nc(), data);
+}
+
 TEST(copy, convert)
 {
     Shape shape;
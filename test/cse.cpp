@@ -341,3 +341,106 @@ TEST(CSE, pass_property)
     ASSERT_TRUE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_FALSE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+TEST(CSE, subtract_not_commutative)
+{
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto sub1 = make_shared<op::Subtract>(A, B);
+    auto sub2 = make_shared<op::Subtract>(B, A);
+    auto sub3 = make_shared<op::Subtract>(A, B);
+    auto f = make_shared<Function>(NodeVector{sub1, sub2, sub3}, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+}
+
+TEST(CSE, attributes)
+{
+    Shape shape{4, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto slice1 = make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 4});
+    auto slice2 = make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 4});
+    auto slice3 = make_shared<op::Slice>(A, Coordinate{2, 0}, Coordinate{4, 4});
+    // A fused op
+    auto clamp1 = make_shared<op::Clamp>(A, 0.0, 1.0);
+    auto clamp2 = make_shared<op::Clamp>(A, 0.0, 1.0);
+    auto clamp3 = make_shared<op::Clamp>(A, 0.0, 2.0);
+    auto f = make_shared<Function>(NodeVector{slice1, slice2, slice3, clamp1, clamp2, clamp3},
+                                   ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    auto result = [&](size_t i) { return f->get_results().at(i)->get_argument(0); };
+    ASSERT_EQ(result(0), result(1));
+    ASSERT_NE(result(0), result(2));
+    ASSERT_EQ(result(3), result(4));
+    ASSERT_NE(result(3), result(5));
+}
+
+TEST(CSE, attributes_not_serialized)
+{
+    // The serializer writes no attributes for AllReduce, so these can not be compared
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::AllReduce>(A, reduction::Type::SUM);
+    auto max = make_shared<op::AllReduce>(A, reduction::Type::MAX);
+    auto f = make_shared<Function>(NodeVector{sum, max}, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+}
+
+TEST(CSE, large_constant)
+{
+    Shape shape{1000};
+    vector<float> values(shape_size(shape), 1.0f);
+    auto c1 = op::Constant::create(element::f32, shape, values);
+    auto c2 = op::Constant::create(element::f32, shape, values);
+    values.back() = 2.0f;
+    auto c3 = op::Constant::create(element::f32, shape, values);
+    auto abs1 = make_shared<op::Abs>(c1);
+    auto abs2 = make_shared<op::Abs>(c2);
+    auto abs3 = make_shared<op::Abs>(c3);
+    auto f = make_shared<Function>(NodeVector{abs1, abs2, abs3}, ParameterVector{});
+
+    EXPECT_EQ(c1->get_attribute_hash(), c2->get_attribute_hash());
+    EXPECT_TRUE(c1->has_same_attributes(*c2));
+    EXPECT_FALSE(c1->has_same_attributes(*c3));
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(abs1->get_argument(0), abs2->get_argument(0));
+    ASSERT_NE(abs1->get_argument(0), abs3->get_argument(0));
+}
+
+TEST(CSE, divide_pythondiv)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto B = make_shared<op::Parameter>(element::i32, shape);
+    auto div1 = make_shared<op::Divide>(A, B, true);
+    auto div2 = make_shared<op::Divide>(A, B, true);
+    auto div3 = make_shared<op::Divide>(A, B, false);
+    auto f = make_shared<Function>(NodeVector{div1, div2, div3}, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    auto result = [&](size_t i) { return f->get_results().at(i)->get_argument(0); };
+    ASSERT_EQ(result(0), result(1));
+    ASSERT_NE(result(0), result(2));
+}
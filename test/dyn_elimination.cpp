@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/pass/dyn_elimination.hpp"
+#include "ngraph/pass/fused_dyn_elimination.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -266,3 +267,32 @@ TEST(dyn_elimination, range_f64)
     ASSERT_TRUE(test::all_close_f(
         vals, vector<double>{-0.5, -0.25, 0, 0.25, 0.5, 0.75, 1.0, 1.25, 1.5, 1.75}));
 }
+
+// The v1 Reshape is only downgraded to a DynReshape after ShapeOf has been folded, and only
+// then can the DynReshape be eliminated, which took several rounds of separate passes.
+TEST(dyn_elimination, fused_single_run)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto shape_source = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+
+    auto shape_of = make_shared<op::ShapeOf>(shape_source);
+    auto reshape = make_shared<op::v1::Reshape>(data, shape_of, false);
+    auto neg = make_shared<op::Negative>(reshape);
+
+    auto f = make_shared<Function>(neg, ParameterVector{data, shape_source});
+    ASSERT_TRUE(f->is_dynamic());
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::FusedDynElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::ShapeOf>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Reshape>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::DynReshape>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 1);
+
+    auto new_neg = as_type_ptr<op::Negative>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_neg);
+    ASSERT_EQ(new_neg->get_output_shape(0), (Shape{3, 2}));
+    ASSERT_FALSE(f->is_dynamic());
+}
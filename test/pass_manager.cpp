@@ -23,6 +23,7 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/test_tools.hpp"
 
@@ -67,3 +68,72 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+TEST(pass_manager, profile)
+{
+    Shape shape{2};
+    auto a = op::Constant::create(element::f32, shape, {1, 2});
+    auto b = op::Constant::create(element::f32, shape, {3, 4});
+    auto p = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(make_shared<op::Add>(a, b), p),
+                                   ParameterVector{p});
+
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_pass_profiling(true);
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.run_passes(f);
+
+    const pass::PassProfile& profile = pass_manager.get_profile();
+    auto& entries = profile.get_entries();
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_NE(entries[0].name.find("ConstantFolding"), string::npos);
+    EXPECT_EQ(entries[0].node_count_before, 6);
+    EXPECT_EQ(entries[0].node_count_after, 4);
+    EXPECT_TRUE(entries[0].changed);
+    EXPECT_NE(entries[1].name.find("DummyPass"), string::npos);
+    EXPECT_EQ(entries[1].node_count_before, 4);
+    EXPECT_EQ(entries[1].node_count_after, 4);
+    EXPECT_FALSE(entries[1].changed);
+    EXPECT_EQ(entries[1].graph_size, f->get_graph_size());
+    // Two constants were folded into one, so the graph was largest before any pass ran
+    EXPECT_GT(profile.get_peak_graph_size(), entries[0].graph_size);
+
+    pass_manager.set_pass_profiling(false);
+    pass_manager.run_passes(f);
+    EXPECT_TRUE(pass_manager.get_profile().empty());
+}
+
+TEST(pass_manager, validate_edited_nodes)
+{
+    auto p = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto abs = make_shared<op::Abs>(p);
+    auto neg = make_shared<op::Negative>(abs);
+    auto q = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto exp = make_shared<op::Exp>(q);
+    auto f = make_shared<Function>(NodeVector{neg, exp}, ParameterVector{p, q});
+    for (auto& node : f->get_ops())
+    {
+        EXPECT_FALSE(node->needs_revalidation());
+    }
+
+    p->set_partial_shape(Shape{4, 5});
+    exp->input(0).replace_source_output(q);
+    EXPECT_TRUE(p->needs_revalidation());
+    EXPECT_TRUE(exp->needs_revalidation());
+    EXPECT_FALSE(abs->needs_revalidation());
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.run_passes(f);
+
+    // The new shape of p reaches the results, reconnecting exp kept its type
+    EXPECT_EQ(neg->get_shape(), (Shape{4, 5}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{4, 5}));
+    EXPECT_EQ(f->get_output_shape(1), (Shape{2, 3}));
+    for (auto& node : f->get_ops())
+    {
+        EXPECT_FALSE(node->needs_revalidation());
+    }
+}
@@ -17,6 +17,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -27,6 +28,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_scheduling.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "util/test_tools.hpp"
 
@@ -232,3 +234,72 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+// Each branch broadcasts x and reduces the result twice. The default order runs the first
+// reduction of every branch before any second one, keeping all the broadcasts alive.
+static shared_ptr<Function> make_branching_graph(size_t branch_count)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{16});
+    NodeVector firsts;
+    NodeVector seconds;
+    for (size_t i = 0; i < branch_count; i++)
+    {
+        auto b = make_shared<op::Broadcast>(x, Shape{64, 16}, AxisSet{0});
+        firsts.push_back(make_shared<op::Sum>(b, AxisSet{0}));
+        seconds.push_back(make_shared<op::Sum>(make_shared<op::Negative>(b), AxisSet{0}));
+    }
+    NodeVector args = firsts;
+    args.insert(args.end(), seconds.begin(), seconds.end());
+    return make_shared<Function>(make_shared<op::Concat>(args, 0), ParameterVector{x});
+}
+
+TEST(memory_scheduling, branches)
+{
+    auto f = make_branching_graph(8);
+    pass::Manager default_manager;
+    default_manager.register_pass<pass::Liveness>();
+    default_manager.register_pass<pass::MemoryLayout>();
+    default_manager.run_passes(f);
+    size_t default_pool_size = f->get_temporary_pool_size();
+
+    pass::Manager pass_manager;
+    auto scheduling = pass_manager.register_pass<pass::MemoryScheduling>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+
+    size_t broadcast_size = 64 * 16 * sizeof(float);
+    EXPECT_GE(scheduling->get_pool_size_before(), 8 * broadcast_size);
+    EXPECT_LT(scheduling->get_pool_size_after(), 4 * broadcast_size);
+    EXPECT_EQ(default_pool_size, scheduling->get_pool_size_before());
+    EXPECT_EQ(f->get_temporary_pool_size(), scheduling->get_pool_size_after());
+
+    // The new order is still topological
+    unordered_set<Node*> done;
+    for (auto& node : f->get_ordered_ops())
+    {
+        for (auto& input : node->inputs())
+        {
+            EXPECT_EQ(1, done.count(input.get_source_output().get_node()));
+        }
+        done.insert(node.get());
+    }
+    EXPECT_EQ(f->get_ops().size(), done.size());
+}
+
+TEST(memory_scheduling, keeps_better_default)
+{
+    pass::Manager pass_manager;
+    auto scheduling = pass_manager.register_pass<pass::MemoryScheduling>();
+    pass_manager.run_passes(make_test_graph());
+    EXPECT_LE(scheduling->get_pool_size_after(), scheduling->get_pool_size_before());
+
+    // A chain has only one order, which must be left as it is
+    auto x = make_shared<op::Parameter>(element::f32, Shape{16});
+    auto chain = make_shared<op::Negative>(make_shared<op::Abs>(make_shared<op::Negative>(x)));
+    auto f = make_shared<Function>(chain, ParameterVector{x});
+    auto ops = f->get_ordered_ops();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(scheduling->get_pool_size_before(), scheduling->get_pool_size_after());
+    EXPECT_EQ(ops, f->get_ordered_ops());
+}
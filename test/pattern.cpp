@@ -292,6 +292,76 @@ TEST(pattern, graph_rewrite)
     }
 }
 
+TEST(pattern, graph_rewrite_matcher_order)
+{
+    // Matchers are offered a node in the order they were added, whether their pattern is
+    // rooted at an op type or at a Label that can match any node
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto neg = make_shared<op::Negative>(a);
+    auto abs = make_shared<op::Abs>(neg);
+    auto f = make_shared<Function>(abs, ParameterVector{a});
+
+    vector<string> calls;
+    auto record = [&calls](const string& matcher) {
+        return [&calls, matcher](pattern::Matcher& m) {
+            calls.push_back(matcher + ":" + m.get_match_root()->description());
+            return false;
+        };
+    };
+
+    pass::GraphRewrite rewrite;
+    auto first_label = make_shared<pattern::op::Label>(element::i32, shape);
+    rewrite.add_matcher(make_shared<pattern::Matcher>(first_label, "first"), record("first"));
+    auto abs_label = make_shared<pattern::op::Label>(element::i32, shape);
+    auto abs_pattern = make_shared<op::Abs>(abs_label);
+    rewrite.add_matcher(make_shared<pattern::Matcher>(abs_pattern, "abs"), record("abs"));
+    auto last_label = make_shared<pattern::op::Label>(element::i32, shape);
+    rewrite.add_matcher(make_shared<pattern::Matcher>(last_label, "last"), record("last"));
+
+    EXPECT_FALSE(rewrite.run_on_function(f));
+    EXPECT_EQ(calls,
+              (vector<string>{"first:Parameter",
+                              "last:Parameter",
+                              "first:Negative",
+                              "last:Negative",
+                              "first:Abs",
+                              "abs:Abs",
+                              "last:Abs",
+                              "first:Result",
+                              "last:Result"}));
+}
+
+TEST(pattern, graph_rewrite_visits_new_nodes)
+{
+    // The Negative created for the Abs is matched in the same run, without a second sweep
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto neg = make_shared<op::Negative>(a);
+    auto abs = make_shared<op::Abs>(neg);
+    auto f = make_shared<Function>(abs, ParameterVector{a});
+
+    pass::GraphRewrite rewrite;
+    auto abs_label = make_shared<pattern::op::Label>(element::i32, shape);
+    auto abs_pattern = make_shared<op::Abs>(abs_label);
+    auto abs_to_neg = [abs_label](pattern::Matcher& m) {
+        auto arg = m.get_pattern_map()[abs_label];
+        replace_node(m.get_match_root(), make_shared<op::Negative>(arg));
+        return true;
+    };
+    rewrite.add_matcher(make_shared<pattern::Matcher>(abs_pattern, "abs_to_neg"), abs_to_neg);
+    auto neg_label = make_shared<pattern::op::Label>(element::i32, shape);
+    auto neg_neg_pattern = make_shared<op::Negative>(make_shared<op::Negative>(neg_label));
+    auto neg_neg = [neg_label](pattern::Matcher& m) {
+        replace_node(m.get_match_root(), m.get_pattern_map()[neg_label]);
+        return true;
+    };
+    rewrite.add_matcher(make_shared<pattern::Matcher>(neg_neg_pattern, "neg_neg"), neg_neg);
+
+    EXPECT_TRUE(rewrite.run_on_function(f));
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0), a);
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
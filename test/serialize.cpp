@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <iomanip>
+#include <numeric>
 #include <sstream>
 
 #include "gmock/gmock.h"
@@ -760,3 +762,154 @@ TEST(serialize, depth_to_space)
     EXPECT_EQ(depth_to_space_out->get_block_size(), block_size);
     EXPECT_EQ(depth_to_space_out->get_mode(), mode);
 }
+
+TEST(serialize, hash_function)
+{
+    auto make_function = [](float bias, Strides strides) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 2, 8, 8});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{3, 2, 3, 3});
+        auto conv = make_shared<op::Convolution>(A, B, strides);
+        auto C = op::Constant::create(element::f32, conv->get_shape(), {bias});
+        return make_shared<Function>(make_shared<op::Add>(conv, C), ParameterVector{A, B});
+    };
+
+    // Node names differ between the copies but the digest does not
+    string digest = hash_function(make_function(1.0f, Strides{1, 1}));
+    EXPECT_EQ(digest.size(), 64);
+    EXPECT_EQ(digest, hash_function(make_function(1.0f, Strides{1, 1})));
+    EXPECT_EQ(digest, hash_function(deserialize(serialize(make_function(1.0f, Strides{1, 1})))));
+
+    // Constant contents and attributes are part of the digest
+    EXPECT_NE(digest, hash_function(make_function(2.0f, Strides{1, 1})));
+    EXPECT_NE(digest, hash_function(make_function(1.0f, Strides{2, 2})));
+
+    // So is the order of the parameters
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto sub = make_shared<op::Subtract>(A, B);
+    EXPECT_NE(hash_function(make_shared<Function>(sub, ParameterVector{A, B})),
+              hash_function(make_shared<Function>(sub, ParameterVector{B, A})));
+
+    // The serializer does not write the reduce type of AllReduce, so rather than giving these
+    // the same digest it gives them none
+    auto make_all_reduce = [](reduction::Type reduce_type) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+        return make_shared<Function>(make_shared<op::AllReduce>(A, reduce_type),
+                                     ParameterVector{A});
+    };
+    EXPECT_EQ(hash_function(make_all_reduce(reduction::Type::SUM)), "");
+    EXPECT_EQ(hash_function(make_all_reduce(reduction::Type::MAX)), "");
+
+    // Control dependencies are part of the digest
+    auto neg = make_shared<op::Negative>(A);
+    auto abs = make_shared<op::Abs>(B);
+    auto f = make_shared<Function>(NodeVector{neg, abs}, ParameterVector{A, B});
+    digest = hash_function(f);
+    abs->add_control_dependency(neg);
+    EXPECT_NE(hash_function(f), digest);
+}
+
+TEST(serialize, binary_model)
+{
+    const string tmp_file = "serialize_binary_model.bin";
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto C = op::Constant::create(element::i8, Shape{3}, {-1, 0, 1});
+    auto D = op::Constant::create(element::f32, Shape{2, 3}, {0.5f});
+    auto convert = make_shared<op::Convert>(C, element::f32);
+    auto broadcast = make_shared<op::Broadcast>(convert, Shape{2, 3}, AxisSet{0});
+    auto f = make_shared<Function>(A + B + broadcast * D, ParameterVector{A});
+    string digest = hash_function(f);
+
+    serialize_binary(tmp_file, f);
+    auto g = deserialize(tmp_file);
+    file_util::remove_file(tmp_file);
+    ASSERT_NE(g, nullptr);
+    EXPECT_EQ(hash_function(g), digest);
+
+    stringstream ss;
+    serialize_binary(ss, f);
+    auto h = deserialize(ss);
+    ASSERT_NE(h, nullptr);
+    EXPECT_EQ(hash_function(h), digest);
+
+    size_t constant_count = 0;
+    for (auto& node : g->get_ops())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            // Constants use the model data in place, which keeps their alignment
+            EXPECT_EQ(reinterpret_cast<size_t>(constant->get_data_ptr()) % 64, 0);
+            constant_count++;
+        }
+    }
+    EXPECT_EQ(constant_count, 3);
+}
+
+TEST(serialize, large_constant)
+{
+    // Big enough for the values to be decoded on several threads
+    vector<int32_t> values(100000);
+    iota(values.begin(), values.end(), -50000);
+    auto A = op::Constant::create(element::i32, Shape{values.size()}, values);
+    auto B = op::Constant::create(element::f32, Shape{values.size()}, values);
+    auto f = make_shared<Function>(NodeVector{A, B}, ParameterVector{});
+
+    auto g = deserialize(serialize(f));
+    ASSERT_NE(g, nullptr);
+    auto A_copy = as_type_ptr<op::Constant>(g->get_results().at(0)->get_argument(0));
+    auto B_copy = as_type_ptr<op::Constant>(g->get_results().at(1)->get_argument(0));
+    ASSERT_NE(A_copy, nullptr);
+    ASSERT_NE(B_copy, nullptr);
+    EXPECT_EQ(A_copy->get_vector<int32_t>(), values);
+    EXPECT_EQ(B_copy->get_vector<float>(), vector<float>(values.begin(), values.end()));
+}
+
+// Compares the load times of the json models in the zoo when read from a string, from a
+// stream and, after converting them, as mapped binary models
+TEST(benchmark, DISABLED_deserialize_models)
+{
+    const string tmp_file = "benchmark_deserialize_models.bin";
+    size_t total_string = 0;
+    size_t total_stream = 0;
+    size_t total_binary = 0;
+    file_util::iterate_files(
+        SERIALIZED_ZOO,
+        [&](const string& file, bool is_dir) {
+            if (is_dir || file_util::get_file_ext(file) != ".json")
+            {
+                return;
+            }
+            const string json_string = file_util::read_file_to_string(file);
+            stopwatch timer;
+            timer.start();
+            auto f = deserialize(json_string);
+            timer.stop();
+            size_t string_us = timer.get_microseconds();
+
+            ifstream in(file);
+            timer.start();
+            auto g = deserialize(in);
+            timer.stop();
+            size_t stream_us = timer.get_microseconds();
+
+            serialize_binary(tmp_file, f);
+            timer.start();
+            auto h = deserialize(tmp_file);
+            timer.stop();
+            size_t binary_us = timer.get_microseconds();
+            file_util::remove_file(tmp_file);
+
+            EXPECT_EQ(hash_function(g), hash_function(f));
+            EXPECT_EQ(hash_function(h), hash_function(f));
+            total_string += string_us;
+            total_stream += stream_us;
+            total_binary += binary_us;
+            cout << setw(60) << left << file.substr(string(SERIALIZED_ZOO).size() + 1) << right
+                 << setw(10) << string_us << setw(10) << stream_us << setw(10) << binary_us
+                 << "\n";
+        },
+        true);
+    cout << setw(60) << left << "total (us: string, stream, binary)" << right << setw(10)
+         << total_string << setw(10) << total_stream << setw(10) << total_binary << "\n";
+}
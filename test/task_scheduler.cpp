@@ -0,0 +1,119 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/task_scheduler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(task_scheduler, respects_dependencies)
+{
+    // A diamond repeated in a chain: 0 -> {1, 2} -> 3 -> {4, 5} -> 6 ...
+    size_t task_count = 301;
+    runtime::TaskGraph graph(task_count);
+    for (size_t top = 0; top + 3 < task_count; top += 3)
+    {
+        graph.add_dependency(top, top + 1);
+        graph.add_dependency(top, top + 2);
+        graph.add_dependency(top + 1, top + 3);
+        graph.add_dependency(top + 2, top + 3);
+    }
+    // Duplicates are ignored
+    graph.add_dependency(0, 1);
+    EXPECT_EQ(graph.get_predecessor_count(1), 1);
+    EXPECT_ANY_THROW(graph.add_dependency(3, 2));
+
+    runtime::TaskScheduler scheduler(4);
+    for (size_t iteration = 0; iteration < 20; iteration++)
+    {
+        vector<atomic<size_t>> finished(task_count);
+        atomic<size_t> order{0};
+        scheduler.run(graph, [&](size_t task) {
+            for (size_t before = 0; before < task; before++)
+            {
+                const vector<size_t>& successors = graph.get_successors(before);
+                if (find(successors.begin(), successors.end(), task) != successors.end())
+                {
+                    EXPECT_NE(finished[before], 0);
+                }
+            }
+            finished[task] = ++order;
+        });
+        for (size_t task = 0; task < task_count; task++)
+        {
+            EXPECT_NE(finished[task], 0);
+        }
+    }
+}
+
+TEST(task_scheduler, runs_independent_tasks_concurrently)
+{
+    runtime::TaskGraph graph(4);
+    runtime::TaskScheduler scheduler(4);
+    // Every task waits until all four are running, which only finishes if they run at once
+    atomic<size_t> running{0};
+    scheduler.run(graph, [&](size_t) {
+        running++;
+        while (running < 4)
+        {
+            this_thread::yield();
+        }
+    });
+    EXPECT_EQ(running, 4);
+}
+
+TEST(task_scheduler, single_thread_runs_in_order)
+{
+    runtime::TaskGraph graph(10);
+    graph.add_dependency(2, 7);
+    runtime::TaskScheduler scheduler(1);
+    vector<size_t> order;
+    scheduler.run(graph, [&](size_t task) { order.push_back(task); });
+    EXPECT_EQ(order, (vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(task_scheduler, exception)
+{
+    runtime::TaskGraph graph(100);
+    for (size_t task = 1; task < 100; task++)
+    {
+        graph.add_dependency(0, task);
+    }
+    runtime::TaskScheduler scheduler(3);
+    atomic<size_t> calls{0};
+    EXPECT_THROW(scheduler.run(graph,
+                               [&](size_t task) {
+                                   calls++;
+                                   if (task == 0)
+                                   {
+                                       throw runtime_error("task failed");
+                                   }
+                               }),
+                 runtime_error);
+    // Nothing depending on the failed task was started and the scheduler is still usable
+    EXPECT_EQ(calls, 1);
+    calls = 0;
+    scheduler.run(graph, [&](size_t) { calls++; });
+    EXPECT_EQ(calls, 100);
+}
@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(thread_pool, parallel_for_covers_range)
+{
+    runtime::ThreadPool pool(4);
+    vector<int> hits(1000, 0);
+    pool.parallel_for(hits.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            hits[i]++;
+        }
+    });
+    EXPECT_EQ(hits, vector<int>(1000, 1));
+}
+
+TEST(thread_pool, parallel_for_partitions)
+{
+    runtime::ThreadPool pool(3);
+    // ends[begin] records the end of the partition starting at begin
+    vector<size_t> ends(10, 0);
+    atomic<size_t> calls{0};
+    pool.parallel_for(10, 1, [&](size_t begin, size_t end) {
+        ends[begin] = end;
+        calls++;
+    });
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(ends, (vector<size_t>{3, 0, 0, 6, 0, 0, 10, 0, 0, 0}));
+
+    // Work smaller than the grain is not split
+    calls = 0;
+    pool.parallel_for(10, 100, [&](size_t begin, size_t end) {
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 10);
+        calls++;
+    });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(thread_pool, nested_and_serial)
+{
+    runtime::ThreadPool pool(4);
+    atomic<size_t> inner_calls{0};
+    pool.parallel_for(4, 1, [&](size_t, size_t) {
+        pool.parallel_for(100, 1, [&](size_t begin, size_t end) {
+            EXPECT_EQ(begin, 0);
+            EXPECT_EQ(end, 100);
+            inner_calls++;
+        });
+    });
+    EXPECT_EQ(inner_calls, 4);
+
+    runtime::ThreadPool::SerialScope serial;
+    size_t calls = 0;
+    pool.parallel_for(100, 1, [&](size_t, size_t) { calls++; });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(thread_pool, exception)
+{
+    runtime::ThreadPool pool(4);
+    EXPECT_THROW(pool.parallel_for(100,
+                                   1,
+                                   [&](size_t begin, size_t) {
+                                       if (begin > 0)
+                                       {
+                                           throw runtime_error("partition failed");
+                                       }
+                                   }),
+                 runtime_error);
+
+    // The pool is still usable afterwards
+    atomic<size_t> total{0};
+    pool.parallel_for(100, 1, [&](size_t begin, size_t end) { total += end - begin; });
+    EXPECT_EQ(total, 100);
+}
+
+TEST(thread_pool, deterministic_reduction)
+{
+    vector<pair<Shape, AxisSet>> cases{{Shape{3, 50000}, AxisSet{1}},
+                                       {Shape{150000}, AxisSet{0}},
+                                       {Shape{50000, 3}, AxisSet{0}},
+                                       {Shape{7, 300, 70}, AxisSet{0, 2}}};
+    for (auto& c : cases)
+    {
+        const Shape& in_shape = c.first;
+        Shape out_shape = reduce(in_shape, c.second);
+        vector<float> in(shape_size(in_shape));
+        for (size_t i = 0; i < in.size(); i++)
+        {
+            in[i] = 1.0f / static_cast<float>(i % 977 + 1);
+        }
+
+        vector<float> parallel_result(shape_size(out_shape));
+        runtime::reference::sum(
+            in.data(), parallel_result.data(), in_shape, out_shape, c.second);
+
+        vector<float> serial_result(shape_size(out_shape));
+        {
+            runtime::ThreadPool::SerialScope serial;
+            runtime::reference::sum(
+                in.data(), serial_result.data(), in_shape, out_shape, c.second);
+        }
+        EXPECT_EQ(parallel_result, serial_result) << in_shape;
+    }
+}
@@ -73,3 +73,49 @@ TEST(type_prop, DISABLED_benchmark_type_prop_convolution)
     std::cout << "Constructed " << std::fixed << num_iterations << " Convolution ops in "
               << std::fixed << total_nanosec << " ns" << std::endl;
 }
+
+TEST(type_prop, DISABLED_benchmark_per_pass_validation)
+{
+    // A pass usually edits a few nodes of a large graph before Validate runs over it. The
+    // topological order is sorted outside the timers, as the passes share it with Validate.
+    constexpr size_t num_nodes = 100000;
+    constexpr size_t num_iterations = 100;
+
+    auto p = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    NodeVector nodes;
+    shared_ptr<Node> n = p;
+    for (size_t i = 0; i < num_nodes; i++)
+    {
+        n = make_shared<op::Add>(n, p);
+        nodes.push_back(n);
+    }
+    auto f = make_shared<Function>(n, ParameterVector{p});
+
+    stopwatch full_timer;
+    stopwatch edited_timer;
+    size_t full_microsec = 0;
+    size_t edited_microsec = 0;
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        auto& edited = nodes[(i * 7919) % num_nodes];
+
+        edited->input(1).replace_source_output(p);
+        f->get_ordered_ops();
+        full_timer.start();
+        f->validate_nodes_and_infer_types();
+        full_timer.stop();
+        full_microsec += full_timer.get_microseconds();
+
+        edited->input(1).replace_source_output(p);
+        f->get_ordered_ops();
+        edited_timer.start();
+        f->validate_edited_nodes_and_infer_types();
+        edited_timer.stop();
+        edited_microsec += edited_timer.get_microseconds();
+    }
+
+    std::cout.imbue(std::locale(""));
+    std::cout << "Validated " << num_nodes << " nodes after an edit " << num_iterations
+              << " times: " << full_microsec << " us for all nodes, " << edited_microsec
+              << " us for edited nodes" << std::endl;
+}
@@ -29,6 +29,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/sha256.hpp"
 #include "util/all_close.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/ndarray.hpp"
@@ -287,6 +288,27 @@ TEST(util, round_up)
     EXPECT_EQ(8, round_up(5, 4));
 }
 
+TEST(util, sha256)
+{
+    EXPECT_EQ(sha256_hex(""),
+              "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    EXPECT_EQ(sha256_hex("abc"),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    // Padding spills into a second block
+    EXPECT_EQ(sha256_hex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+
+    // Data given in pieces that do not line up with the blocks
+    string message(1000000, 'a');
+    SHA256 digest;
+    for (size_t i = 0; i < message.size(); i += 997)
+    {
+        digest.update(message.data() + i, min<size_t>(997, message.size() - i));
+    }
+    EXPECT_EQ(digest.get_hex(),
+              "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
 TEST(util, parse_string)
 {
     EXPECT_FLOAT_EQ(2, parse_string<float>("2"));
@@ -302,6 +324,14 @@ TEST(util, parse_string)
     EXPECT_FLOAT_EQ(numeric_limits<double>::infinity(), parse_string<double>("infinity"));
     EXPECT_FLOAT_EQ(-numeric_limits<double>::infinity(), parse_string<double>("-INFINITY"));
     EXPECT_TRUE(std::isnan(parse_string<double>("NaN")));
+
+    EXPECT_EQ(-42, parse_string<int64_t>("-42"));
+    EXPECT_EQ(numeric_limits<int64_t>::max(), parse_string<int64_t>("9223372036854775807"));
+    EXPECT_ANY_THROW(parse_string<int64_t>("9223372036854775808"));
+    EXPECT_ANY_THROW(parse_string<int64_t>("1.5"));
+    EXPECT_ANY_THROW(parse_string<int64_t>(""));
+    EXPECT_EQ(numeric_limits<uint64_t>::max(), parse_string<uint64_t>("18446744073709551615"));
+    EXPECT_ANY_THROW(parse_string<uint64_t>("12a"));
 }
 
 TEST(graph_util, get_subgraph_outputs_trivial_tests)
@@ -560,6 +590,77 @@ TEST(graph, huge)
     }
 }
 
+TEST(graph, ordered_ops_follow_edits)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto neg = make_shared<op::Negative>(a);
+    auto abs = make_shared<op::Abs>(neg);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{a, b});
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, f->get_ordered_ops());
+    EXPECT_EQ(ops, topological_sort(NodeVector{f->get_results().at(0), a, b}, true));
+
+    auto sin = make_shared<op::Sin>(b);
+    replace_node(neg, sin);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(count(ops.begin(), ops.end(), neg), 0);
+    EXPECT_LT(distance(ops.begin(), find(ops.begin(), ops.end(), sin)),
+              distance(ops.begin(), find(ops.begin(), ops.end(), abs)));
+
+    // Control dependencies are followed unless excluded
+    auto cos = make_shared<op::Cos>(a);
+    abs->add_control_dependency(cos);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(count(ops.begin(), ops.end(), cos), 1);
+    ops = f->get_ordered_ops(false);
+    EXPECT_EQ(count(ops.begin(), ops.end(), cos), 0);
+    abs->remove_control_dependency(cos);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(count(ops.begin(), ops.end(), cos), 0);
+
+    // a has no users left, so only the parameter list refers to it
+    auto c = make_shared<op::Parameter>(element::f32, Shape{2});
+    f->replace_parameter(0, c);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(count(ops.begin(), ops.end(), a), 0);
+    EXPECT_EQ(count(ops.begin(), ops.end(), c), 1);
+}
+
+TEST(graph, DISABLED_benchmark_get_ordered_ops)
+{
+    // A long chain with a side branch at every step, so the sort has real work to do
+    auto param = make_shared<op::Parameter>(element::f32, Shape{3, 3});
+    std::shared_ptr<Node> n = param;
+    for (size_t i = 0; i < 100000; i++)
+    {
+        n = make_shared<op::Add>(make_shared<op::Negative>(n), n);
+    }
+    auto f = make_shared<Function>(NodeVector{n}, ParameterVector{param});
+
+    constexpr size_t num_iterations = 100;
+    stopwatch sort_timer;
+    stopwatch cached_timer;
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        sort_timer.start();
+        auto sorted = topological_sort(NodeVector{f->get_results().at(0), param}, true);
+        sort_timer.stop();
+
+        cached_timer.start();
+        auto ordered = f->get_ordered_ops();
+        cached_timer.stop();
+        ASSERT_EQ(sorted.size(), ordered.size());
+    }
+
+    std::cout.imbue(std::locale(""));
+    std::cout << "Sorted " << f->get_ordered_ops().size() << " ops " << num_iterations
+              << " times: topological_sort " << sort_timer.get_total_milliseconds()
+              << " ms, get_ordered_ops " << cached_timer.get_total_milliseconds() << " ms"
+              << std::endl;
+}
+
 TEST(util, apply_permutation)
 {
     ASSERT_EQ(apply_permutation(Shape{0, 1, 2, 3}, AxisVector{2, 1, 0, 3}), (Shape{2, 1, 0, 3}));